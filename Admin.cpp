@@ -1,4 +1,6 @@
 ﻿#include "Admin.h"
+#include "GameManager.h"
+#include "TaskPool.h"
 #include <iostream>
 #include <limits>
 #include <cctype>
@@ -9,11 +11,29 @@ static void clearCin() {
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
 }
 
-// ===================== HASH REBUILD (after remove shift) =====================
-static void rebuildGameHash(HashTable& gameHash, Game games[], int gameCount) {
-    gameHash.clear();
-    for (int i = 0; i < gameCount; i++) {
-        gameHash.insert(games[i].getGameID(), i);
+// ===================== JOURNAL: GAME RECORDS =====================
+static void journalGame(JournalEntryType type, const Game& game, Journal& journal) {
+    JournalEntry entry(type);
+    entry.putString(game.getGameID());
+    entry.putString(game.getTitle());
+    entry.putInt(game.getMinPlayers());
+    entry.putInt(game.getMaxPlayers());
+    entry.putInt(game.getMinPlaytime());
+    entry.putInt(game.getMaxPlaytime());
+    entry.putInt(game.getYear());
+    journal.append(entry);
+}
+
+// ===================== POSITION SORT (short lists) =====================
+static void sortPositions(int arr[], int count) {
+    for (int i = 1; i < count; i++) {
+        int value = arr[i];
+        int j = i - 1;
+        while (j >= 0 && arr[j] > value) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = value;
     }
 }
 
@@ -24,46 +44,6 @@ static string toLowerCopy(const string& s) {
     return out;
 }
 
-// ===================== MERGE SORT: BORROW COUNT =====================
-static void mergeByBorrowCount(Game arr[], int left, int mid, int right, bool descending) {
-    int n1 = mid - left + 1;
-    int n2 = right - mid;
-
-    Game* L = new Game[n1];
-    Game* R = new Game[n2];
-
-    for (int i = 0; i < n1; i++) L[i] = arr[left + i];
-    for (int j = 0; j < n2; j++) R[j] = arr[mid + 1 + j];
-
-    int i = 0, j = 0, k = left;
-
-    while (i < n1 && j < n2) {
-        int a = L[i].getBorrowCount();
-        int b = R[j].getBorrowCount();
-
-        bool takeLeft;
-        if (descending) takeLeft = (a >= b);
-        else           takeLeft = (a <= b);
-
-        if (takeLeft) arr[k++] = L[i++];
-        else          arr[k++] = R[j++];
-    }
-
-    while (i < n1) arr[k++] = L[i++];
-    while (j < n2) arr[k++] = R[j++];
-
-    delete[] L;
-    delete[] R;
-}
-
-static void mergeSortByBorrowCount(Game arr[], int left, int right, bool descending) {
-    if (left >= right) return;
-    int mid = left + (right - left) / 2;
-    mergeSortByBorrowCount(arr, left, mid, descending);
-    mergeSortByBorrowCount(arr, mid + 1, right, descending);
-    mergeByBorrowCount(arr, left, mid, right, descending);
-}
-
 // ===================== MERGE SORT: TITLE =====================
 /*
 static void mergeByTitle(Game arr[], int left, int mid, int right, bool ascending) {
@@ -106,37 +86,82 @@ static void mergeSortByTitle(Game arr[], int left, int right, bool ascending) {
 }
 */
 // ===================== DISPLAY LIST HELPER =====================
-static void printGameList(Game arr[], int count) {
+static void printGameList(const SegmentedArray<Game>& games, const int order[], int count, int firstRank = 1) {
     cout << "\n--------------------------------------------------------------------------------\n";
     cout << "No | GameID | Title                               | Year | BorrowCount | Status\n";
     cout << "--------------------------------------------------------------------------------\n";
 
     for (int i = 0; i < count; i++) {
-        cout << (i + 1) << "  | ";
-        cout << arr[i].getGameID() << "  | ";
+        cout << (firstRank + i) << "  | ";
+        const Game& game = games[order[i]];
+        cout << game.getGameID() << "  | ";
 
-        string title = arr[i].getTitle();
-        if (title.length() > 35) title = title.substr(0, 32) + "...";
-        cout << title;
-        for (int s = (int)title.length(); s < 35; s++) cout << " ";
+        printColumn(game.getTitle(), 35);
 
-        cout << " | " << arr[i].getYear() << " | ";
-        cout << arr[i].getBorrowCount() << "          | ";
-        cout << arr[i].getStatus() << "\n";
+        cout << " | " << game.getYear() << " | ";
+        cout << game.getBorrowCount() << "          | ";
+        cout << game.getStatus() << "\n";
     }
 
     cout << "--------------------------------------------------------------------------------\n";
 }
 
+// ===================== ADMIN: APPLY (shared with journal replay) =====================
+bool adminApplyAddGame(SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, const Game& game) {
+    if (gameHash.search(game.getGameID()) != -1) return false;
+
+    // Lowest free slot, or a new one at the end of the array
+    int slot = gameSlots.acquire();
+    if (slot == games.size()) games.add(game);
+    else games[slot] = game;
+    gameHash.insert(game.getGameID(), slot);
+    catalog.place(slot, games[slot]);
+    return true;
+}
+
+bool adminApplyRemoveGame(SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, const string& id) {
+    int idx = gameHash.search(id);
+    if (idx == -1) return false;
+    if (games[idx].getStatus() == "Borrowed") return false;
+
+    // The slot is emptied in place: no other game moves, so only
+    // this key leaves the hash and no other index needs fixing
+    catalog.release(idx);
+    gameHash.remove(id);
+    games[idx] = Game();
+    gameSlots.release(idx);
+    return true;
+}
+
+// Replaces the catalog fields of an existing game; its status,
+// borrower and borrow count are kept
+bool adminApplyUpdateGame(SegmentedArray<Game>& games, HashTable& gameHash, GameCatalog& catalog, const Game& game) {
+    int idx = gameHash.search(game.getGameID());
+    if (idx == -1) return false;
+
+    Game edited = game;
+    edited.setStatus(games[idx].getStatus());
+    edited.setBorrowedBy(games[idx].getBorrowerKey());
+    edited.setBorrowCount(games[idx].getBorrowCount());
+    // Out of the views under the old title, back in under the new
+    catalog.release(idx);
+    games[idx] = edited;
+    catalog.place(idx, games[idx]);
+    return true;
+}
+
+bool adminApplyAddMember(SegmentedArray<Member>& members, HashMap<string, int>& memberHash, const Member& member) {
+    if (memberHash.contains(member.getMemberID())) return false;
+
+    memberHash.insert(member.getMemberID(), members.size());
+    members.add(member);
+    return true;
+}
+
 // ===================== ADMIN: ADD GAME =====================
-void adminAddGame(Game games[], int& gameCount, int maxGames, HashTable& gameHash) {
+void adminAddGame(SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, Journal& journal) {
     cout << "\n=== Admin: Add New Board Game ===\n";
 
-    if (gameCount >= maxGames) {
-        cout << "ERROR: Cannot add. Game storage is full.\n";
-        return;
-    }
-
     string id, title;
     int minP, maxP, minT, maxT, year;
 
@@ -174,15 +199,15 @@ void adminAddGame(Game games[], int& gameCount, int maxGames, HashTable& gameHas
     if (minT <= 0 || maxT <= 0 || minT > maxT) { cout << "ERROR: Invalid playtime range.\n"; return; }
     if (year <= 0) { cout << "ERROR: Invalid year.\n"; return; }
 
-    games[gameCount] = Game(id, title, minP, maxP, minT, maxT, year);
-    gameHash.insert(id, gameCount);
-    gameCount++;
+    Game game(id, title, minP, maxP, minT, maxT, year);
+    adminApplyAddGame(games, gameSlots, gameHash, catalog, game);
+    journalGame(JOURNAL_ADD_GAME, game, journal);
 
     cout << "SUCCESS: Game added.\n";
 }
 
 // ===================== ADMIN: REMOVE GAME =====================
-void adminRemoveGame(Game games[], int& gameCount, HashTable& gameHash) {
+void adminRemoveGame(SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, Journal& journal) {
     cout << "\n=== Admin: Remove Board Game ===\n";
 
     string id;
@@ -198,35 +223,28 @@ void adminRemoveGame(Game games[], int& gameCount, HashTable& gameHash) {
         return;
     }
 
-    for (int i = idx; i < gameCount - 1; i++) {
-        games[i] = games[i + 1];
-    }
-    gameCount--;
+    adminApplyRemoveGame(games, gameSlots, gameHash, catalog, id);
+
+    JournalEntry entry(JOURNAL_REMOVE_GAME);
+    entry.putString(id);
+    journal.append(entry);
 
-    rebuildGameHash(gameHash, games, gameCount);
     cout << "SUCCESS: Game removed.\n";
 }
 
 // ===================== ADMIN: ADD MEMBER =====================
-void adminAddMember(Member members[], int& memberCount, int maxMembers) {
+void adminAddMember(SegmentedArray<Member>& members, HashMap<string, int>& memberHash, Journal& journal) {
     cout << "\n=== Admin: Add New Member ===\n";
 
-    if (memberCount >= maxMembers) {
-        cout << "ERROR: Cannot add. Member storage is full.\n";
-        return;
-    }
-
     string id, name, email;
 
     cout << "Member ID: ";
     getline(cin, id);
     if (id.empty()) { cout << "ERROR: Member ID cannot be empty.\n"; return; }
 
-    for (int i = 0; i < memberCount; i++) {
-        if (members[i].getMemberID() == id) {
-            cout << "ERROR: Member ID already exists.\n";
-            return;
-        }
+    if (memberHash.contains(id)) {
+        cout << "ERROR: Member ID already exists.\n";
+        return;
     }
 
     cout << "Name: ";
@@ -237,49 +255,257 @@ void adminAddMember(Member members[], int& memberCount, int maxMembers) {
     getline(cin, email);
     if (email.empty()) { cout << "ERROR: Email cannot be empty.\n"; return; }
 
-    members[memberCount] = Member(id, name, email);
-    memberCount++;
+    adminApplyAddMember(members, memberHash, Member(id, name, email));
+
+    JournalEntry entry(JOURNAL_ADD_MEMBER);
+    entry.putString(id);
+    entry.putString(name);
+    entry.putString(email);
+    journal.append(entry);
 
     cout << "SUCCESS: Member added.\n";
 }
 
+// ===================== ADMIN: RELOAD GAMES (diff-apply) =====================
+static bool sameCatalogFields(const Game& a, const Game& b) {
+    return a.getTitle() == b.getTitle() &&
+        a.getMinPlayers() == b.getMinPlayers() && a.getMaxPlayers() == b.getMaxPlayers() &&
+        a.getMinPlaytime() == b.getMinPlaytime() && a.getMaxPlaytime() == b.getMaxPlaytime() &&
+        a.getYear() == b.getYear();
+}
+
+// What identifies a game across reloads: the file has no ID column
+// and its row numbers shift, so the title and year are used
+static string reloadKey(const Game& game) {
+    return game.getTitle() + '\n' + to_string(game.getYear());
+}
+
+// Next game number whose ID was never used before the reload
+// (handles below knownIds were interned before the file was read)
+static string unusedGameID(int& number, int knownIds) {
+    while (true) {
+        string id = formatGameID(number++);
+        IdHandle handle = gameIds.find(id);
+        if (handle == NO_ID || (int)handle >= knownIds) return id;
+    }
+}
+
+/*
+============================================================
+Function    : adminReloadGames
+Description : Re-reads the games CSV while the program runs
+              and applies only the difference to the catalog.
+              File rows are matched to games by title and
+              year, never by the positional IDs the loader
+              gives them, so a row inserted or deleted
+              mid-file does not move any other game. Games
+              sharing a title and year are matched in slot
+              order.
+              - games no longer in the file are removed, unless
+                they are borrowed (then they stay until a later
+                reload finds them returned); this includes
+                games added from the menu, the file being the
+                catalog;
+              - matched games whose player range or playtime
+                changed are edited in place, keeping their ID,
+                status, borrower and borrow count;
+              - unmatched rows are added under an ID that was
+                never used, so no loan or history refers to it.
+                A renamed game is a removal and an addition.
+              Unchanged games are not touched. Every index is
+              updated through the same apply functions as the
+              menu options, and every change is journaled. A
+              file that yields no games leaves the catalog
+              as it is.
+Input       : filename - CSV to read (const string&)
+              games, gameSlots - The catalog
+              gameHash - Game ID -> index (HashTable&)
+              catalog - Columns and views (GameCatalog&)
+              journal - Receives one record per change
+Return      : True if the catalog changed (bool)
+============================================================
+*/
+bool adminReloadGames(const string& filename, SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, Journal& journal) {
+    cout << "\n=== Admin: Reload Games from " << filename << " ===\n";
+
+    int knownIds = gameIds.size();
+    SegmentedArray<Game> incoming;
+    int incomingCount = loadGamesFromCSV(filename, incoming, nullptr, &sharedTaskPool());
+    if (incomingCount == 0) {
+        cout << "ERROR: No games read. Catalog left unchanged.\n";
+        return false;
+    }
+
+    // Current games by title and year; games sharing both are
+    // chained in slot order through nextSameKey
+    int slots = gameSlots.slotCount();
+    HashMap<string, int> firstByKey;
+    int* nextSameKey = new int[slots + 1];
+    for (int idx = slots - 1; idx >= 0; idx--) {
+        if (!gameSlots.isLive(idx)) continue;
+        string key = reloadKey(games[idx]);
+        nextSameKey[idx] = firstByKey.search(key);
+        firstByKey.insert(key, idx);
+    }
+
+    // Match file rows to current games
+    bool* inFile = new bool[slots + 1];
+    for (int i = 0; i < slots; i++) inFile[i] = false;
+    int* edited = new int[incomingCount];
+    int* editedSlot = new int[incomingCount];
+    int* added = new int[incomingCount];
+    int editedCount = 0, addedCount = 0;
+
+    for (int i = 0; i < incomingCount; i++) {
+        int idx = firstByKey.search(reloadKey(incoming[i]));
+        while (idx != -1 && inFile[idx]) idx = nextSameKey[idx];
+        if (idx == -1) {
+            added[addedCount++] = i;
+        }
+        else {
+            inFile[idx] = true;
+            if (!sameCatalogFields(games[idx], incoming[i])) {
+                edited[editedCount] = i;
+                editedSlot[editedCount++] = idx;
+            }
+        }
+    }
+
+    // Removals first, so additions can reuse the freed slots
+    int removed = 0, keptBorrowed = 0;
+    for (int idx = 0; idx < slots; idx++) {
+        if (inFile[idx] || !gameSlots.isLive(idx)) continue;
+        if (games[idx].getStatus() == "Borrowed") {
+            keptBorrowed++;
+            continue;
+        }
+        string id = games[idx].getGameID();
+        adminApplyRemoveGame(games, gameSlots, gameHash, catalog, id);
+
+        JournalEntry entry(JOURNAL_REMOVE_GAME);
+        entry.putString(id);
+        journal.append(entry);
+        removed++;
+    }
+
+    for (int i = 0; i < editedCount; i++) {
+        const Game& row = incoming[edited[i]];
+        Game game(games[editedSlot[i]].getGameID(), row.getTitle(), row.getMinPlayers(), row.getMaxPlayers(),
+            row.getMinPlaytime(), row.getMaxPlaytime(), row.getYear());
+        adminApplyUpdateGame(games, gameHash, catalog, game);
+        journalGame(JOURNAL_UPDATE_GAME, game, journal);
+    }
+
+    int nextNumber = 1;
+    for (int i = 0; i < addedCount; i++) {
+        const Game& row = incoming[added[i]];
+        Game game(unusedGameID(nextNumber, knownIds), row.getTitle(), row.getMinPlayers(), row.getMaxPlayers(),
+            row.getMinPlaytime(), row.getMaxPlaytime(), row.getYear());
+        adminApplyAddGame(games, gameSlots, gameHash, catalog, game);
+        journalGame(JOURNAL_ADD_GAME, game, journal);
+    }
+
+    cout << "SUCCESS: " << addedCount << " added, " << editedCount << " updated, "
+        << removed << " removed, " << (incomingCount - addedCount - editedCount) << " unchanged.\n";
+    if (keptBorrowed > 0) {
+        cout << keptBorrowed << " game(s) missing from the file were kept because they are borrowed.\n";
+    }
+
+    delete[] nextSameKey;
+    delete[] inFile;
+    delete[] edited;
+    delete[] editedSlot;
+    delete[] added;
+    return addedCount + editedCount + removed > 0;
+}
+
 // ===================== ADMIN: SUMMARY =====================
-void adminDisplaySummary(Game games[], int gameCount) {
+void adminDisplaySummary(SegmentedArray<Game>& games, const SlotMap& gameSlots, const GameCatalog& catalog, const LoanIndex& loans) {
     cout << "\n=== Admin: Summary of Games Borrowed/Returned ===\n";
 
-    int borrowedNow = 0;
-    int availableNow = 0;
+    int borrowedNow = loans.openCount();
+    int availableNow = gameSlots.size() - borrowedNow;
     int totalBorrowEvents = 0;
 
-    for (int i = 0; i < gameCount; i++) {
-        if (games[i].getStatus() == "Borrowed") borrowedNow++;
-        else availableNow++;
-
-        totalBorrowEvents += games[i].getBorrowCount();
+    for (int i = 0; i < gameSlots.slotCount(); i++) {
+        if (gameSlots.isLive(i)) totalBorrowEvents += games[i].getBorrowCount();
     }
 
-    cout << "Total Games: " << gameCount << "\n";
+    cout << "Total Games: " << gameSlots.size() << "\n";
     cout << "Borrowed (Currently): " << borrowedNow << "\n";
     cout << "Returned/Available (Currently): " << availableNow << "\n";
     cout << "Total Times Borrowed (All Games): " << totalBorrowEvents << "\n";
 
     if (borrowedNow > 0) {
+        // Open loans come from the loan index; list them in catalog order
+        int* onLoan = new int[borrowedNow];
+        for (int i = 0; i < borrowedNow; i++) {
+            onLoan[i] = catalog.findRow(loans.openGameAt(i));
+        }
+        sortPositions(onLoan, borrowedNow);
+
         cout << "\n--- Currently Borrowed Games ---\n";
-        for (int i = 0; i < gameCount; i++) {
-            if (games[i].getStatus() == "Borrowed") {
-                cout << games[i].getGameID()
-                    << " | " << games[i].getTitle()
-                    << " | Borrowed By: " << games[i].getBorrowedBy()
-                    << "\n";
-            }
+        for (int i = 0; i < borrowedNow; i++) {
+            const Game& game = games[onLoan[i]];
+            cout << game.getGameID()
+                << " | " << game.getTitle()
+                << " | Borrowed By: " << game.getBorrowedBy()
+                << "\n";
         }
+        delete[] onLoan;
     }
 
     cout << "============================================\n";
 }
 
+// ===================== TOP-K MOST BORROWED (paged) =====================
+static void browseMostBorrowed(const SegmentedArray<Game>& games, int gameCount, const GameCatalog& catalog) {
+    int pageSize;
+    cout << "Games per page (e.g. 10 for a top 10): ";
+    if (!(cin >> pageSize) || pageSize <= 0) {
+        clearCin();
+        cout << "ERROR: Invalid page size.\n";
+        return;
+    }
+    clearCin();
+    if (pageSize > gameCount) pageSize = gameCount;
+
+    // Each page is read straight off the catalog's borrow-count view
+    int* page = new int[pageSize];
+    int offset = 0;
+    string command;
+
+    while (true) {
+        int shown = catalog.mostBorrowed(offset, pageSize, page);
+        cout << "\n=== MOST BORROWED: RANKS " << (offset + 1) << "-" << (offset + shown)
+            << " OF " << gameCount << " ===\n";
+        printGameList(games, page, shown, offset + 1);
+
+        cout << "N) Next page   P) Previous page   0) Back\n";
+        cout << "Choice: ";
+        if (!getline(cin, command)) break;
+
+        if (command == "N" || command == "n") {
+            if (offset + pageSize < gameCount) offset += pageSize;
+            else cout << "Already on the last page.\n";
+        }
+        else if (command == "P" || command == "p") {
+            if (offset > 0) offset -= pageSize;
+            else cout << "Already on the first page.\n";
+        }
+        else if (command == "0") {
+            break;
+        }
+        else {
+            cout << "ERROR: Invalid option.\n";
+        }
+    }
+
+    delete[] page;
+}
+
 // ===================== DISPLAY ALL GAMES BY BORROW COUNT =====================
-void adminDisplayAllGamesSorted(Game games[], int gameCount) {
+void adminDisplayAllGamesSorted(SegmentedArray<Game>& games, int gameCount, const GameCatalog& catalog) {
     if (gameCount <= 0) {
         cout << "No games to display.\n";
         return;
@@ -292,6 +518,7 @@ void adminDisplayAllGamesSorted(Game games[], int gameCount) {
         cout << "======================================\n";
         cout << "1) Most Borrowed -> Least Borrowed\n";
         cout << "2) Least Borrowed -> Most Borrowed\n";
+        cout << "3) Top Most Borrowed (page by page)\n";
         cout << "0) Back\n";
         cout << "Choice: ";
 
@@ -303,27 +530,31 @@ void adminDisplayAllGamesSorted(Game games[], int gameCount) {
         clearCin();
 
         if (choice == 0) break;
+        if (choice == 3) {
+            browseMostBorrowed(games, gameCount, catalog);
+            continue;
+        }
 
-        Game* temp = new Game[gameCount];
-        for (int i = 0; i < gameCount; i++) temp[i] = games[i];
+        // The catalog keeps games in borrow-count order already
+        int* order = new int[gameCount];
 
         switch (choice) {
         case 1:
-            mergeSortByBorrowCount(temp, 0, gameCount - 1, true);
+            catalog.orderedRows(SORT_BY_BORROWS_DESC, order);
             cout << "\n=== ALL GAMES SORTED BY BORROWCOUNT (HIGH -> LOW) ===\n";
-            printGameList(temp, gameCount);
+            printGameList(games, order, gameCount);
             break;
         case 2:
-            mergeSortByBorrowCount(temp, 0, gameCount - 1, false);
+            catalog.orderedRows(SORT_BY_BORROWS_ASC, order);
             cout << "\n=== ALL GAMES SORTED BY BORROWCOUNT (LOW -> HIGH) ===\n";
-            printGameList(temp, gameCount);
+            printGameList(games, order, gameCount);
             break;
         default:
             cout << "ERROR: Invalid option.\n";
             break;
         }
 
-        delete[] temp;
+        delete[] order;
 
     } while (choice != 0);
 }
\ No newline at end of file
@@ -2,14 +2,26 @@
 #include "Game.h"
 #include "Member.h"
 #include "HashTable.h"
+#include "GameCatalog.h"
+#include "LoanIndex.h"
+#include "Journal.h"
+#include "SlotMap.h"
+#include "SegmentedArray.h"
 
-// Admin functions
-void adminAddGame(Game games[], int& gameCount, int maxGames, HashTable& gameHash);
-void adminRemoveGame(Game games[], int& gameCount, HashTable& gameHash);
-void adminAddMember(Member members[], int& memberCount, int maxMembers);
+// Admin functions (successful changes are logged to the journal)
+void adminAddGame(SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, Journal& journal);
+void adminRemoveGame(SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, Journal& journal);
+void adminAddMember(SegmentedArray<Member>& members, HashMap<string, int>& memberHash, Journal& journal);
+bool adminReloadGames(const string& filename, SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, Journal& journal);
+
+// Quiet versions of the above, shared with journal replay
+bool adminApplyAddGame(SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, const Game& game);
+bool adminApplyRemoveGame(SegmentedArray<Game>& games, SlotMap& gameSlots, HashTable& gameHash, GameCatalog& catalog, const string& id);
+bool adminApplyUpdateGame(SegmentedArray<Game>& games, HashTable& gameHash, GameCatalog& catalog, const Game& game);
+bool adminApplyAddMember(SegmentedArray<Member>& members, HashMap<string, int>& memberHash, const Member& member);
 
 // Existing summary (keep if you want)
-void adminDisplaySummary(Game games[], int gameCount);
+void adminDisplaySummary(SegmentedArray<Game>& games, const SlotMap& gameSlots, const GameCatalog& catalog, const LoanIndex& loans);
 
 // ✅ NEW: display ALL games sorted by different ways
-void adminDisplayAllGamesSorted(Game games[], int gameCount);
+void adminDisplayAllGamesSorted(SegmentedArray<Game>& games, int gameCount, const GameCatalog& catalog);
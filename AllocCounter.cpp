@@ -0,0 +1,134 @@
+#include "AllocCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+using namespace std;
+
+static atomic<long long> allocationCount(0);
+
+/*
+============================================================
+Function    : operator new (global replacement)
+Description : Counts the allocation, then allocates with
+              malloc. Array new and the nothrow forms forward
+              here; the over-aligned forms (types such as
+              Member, declared alignas(32)) are replaced
+              below, so every heap allocation is counted.
+Input       : size - Number of bytes requested (size_t)
+Return      : Pointer to the allocated memory (void*)
+============================================================
+*/
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    if (size == 0) size = 1;
+    void* p = malloc(size);
+    if (p == nullptr) throw bad_alloc();
+    return p;
+}
+
+/*
+============================================================
+Function    : operator delete (global replacement)
+Description : Releases memory obtained from operator new.
+Input       : p - Pointer to release (void*)
+Return      : None
+============================================================
+*/
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+/*
+============================================================
+Function    : operator new (aligned, global replacement)
+Description : Counts the allocation, then allocates on an
+              'alignment' boundary. Used for types aligned
+              beyond what malloc guarantees; the aligned array
+              and nothrow forms forward here. aligned_alloc
+              wants the size to be a multiple of the
+              alignment, so it is rounded up.
+Input       : size - Number of bytes requested (size_t)
+              alignment - Required alignment (align_val_t)
+Return      : Pointer to the allocated memory (void*)
+============================================================
+*/
+void* operator new(size_t size, align_val_t alignment) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    size_t align = (size_t)alignment;
+    if (size == 0) size = 1;
+#ifdef _WIN32
+    void* p = _aligned_malloc(size, align);
+#else
+    void* p = aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+    if (p == nullptr) throw bad_alloc();
+    return p;
+}
+
+/*
+============================================================
+Function    : operator delete (aligned, global replacement)
+Description : Releases memory obtained from the aligned
+              operator new.
+Input       : p - Pointer to release (void*)
+Return      : None
+============================================================
+*/
+void operator delete(void* p, align_val_t) noexcept {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+void operator delete(void* p, size_t, align_val_t alignment) noexcept {
+    operator delete(p, alignment);
+}
+
+/*
+============================================================
+Function    : getAllocationCount
+Description : Returns the number of heap allocations made so
+              far by the whole program.
+Input       : None
+Return      : Allocation count (long long)
+============================================================
+*/
+long long getAllocationCount() {
+    return allocationCount.load(memory_order_relaxed);
+}
+
+/*
+============================================================
+Function    : AllocationProbe (Constructor)
+Description : Records the current allocation count.
+Input       : None
+Return      : None
+============================================================
+*/
+AllocationProbe::AllocationProbe() {
+    start = getAllocationCount();
+}
+
+/*
+============================================================
+Function    : allocations
+Description : Returns how many allocations happened since the
+              probe was created.
+Input       : None
+Return      : Allocation count (long long)
+============================================================
+*/
+long long AllocationProbe::allocations() const {
+    return getAllocationCount() - start;
+}
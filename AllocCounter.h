@@ -0,0 +1,23 @@
+#pragma once
+
+// Number of calls to the global operator new since start-up.
+// AllocCounter.cpp replaces operator new/delete, plain and aligned,
+// to keep the count.
+long long getAllocationCount();
+
+/*
+============================================================
+Class       : AllocationProbe
+Description : Snapshot of the allocation count, used to check
+              how many heap allocations a piece of code makes
+              (e.g. a search or a report).
+============================================================
+*/
+class AllocationProbe {
+private:
+    long long start;
+
+public:
+    AllocationProbe();
+    long long allocations() const;  // allocations since construction
+};
@@ -0,0 +1,396 @@
+#include "Benchmark.h"
+#include "GameSorter.h"
+#include "TaskPool.h"
+#include "CsvScanner.h"
+#include "AllocCounter.h"
+#include "GameResultSet.h"
+#include "Member.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <string>
+using namespace std;
+
+/*
+============================================================
+Function    : timeSort
+Description : Sorts a fresh 0..n-1 permutation BENCH_REPEATS
+              times and keeps the fastest run. The last result
+              is left in 'order'.
+Input       : sorter - Sorter to run (GameSorter&)
+              games[] - Games being sorted
+              order[] - Receives the sorted positions
+              n - Number of games (int)
+              mode - Ordering to apply (SortMode)
+Return      : Best time in milliseconds (double)
+============================================================
+*/
+static double timeSort(GameSorter& sorter, const SegmentedArray<Game>& games, int order[], int n, SortMode mode) {
+    double best = 0;
+    for (int run = 0; run < BENCH_REPEATS; run++) {
+        for (int i = 0; i < n; i++) order[i] = i;
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        sorter.sort(games, order, n, mode);
+        chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+
+        if (run == 0 || elapsed.count() < best) best = elapsed.count();
+    }
+    return best;
+}
+
+/*
+============================================================
+Function    : sameOrder
+Description : Checks two permutations element by element.
+Input       : a[], b[] - Permutations to compare
+              n - Length (int)
+Return      : True if identical (bool)
+============================================================
+*/
+static bool sameOrder(const int a[], const int b[], int n) {
+    for (int i = 0; i < n; i++) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+// Slots of games[] that hold a game, in slot order
+static int liveSlots(const SlotMap& gameSlots, DynamicArray<int>& live) {
+    for (int i = 0; i < gameSlots.slotCount(); i++) {
+        if (gameSlots.isLive(i)) live.add(i);
+    }
+    return live.size();
+}
+
+/*
+============================================================
+Function    : runSortBenchmark
+Description : Scales the loaded catalog up to BENCH_SORT_SIZE
+              games (copies with varied borrow counts), sorts
+              it by title and by borrow count sequentially,
+              then on pools of 1, 2, 4 ... up to the machine's
+              thread count. Prints the time and
+              speedup per thread count and checks that every
+              parallel result matches the sequential one.
+Input       : games[] - Loaded catalog
+              gameSlots - Which slots hold a game (const SlotMap&)
+Return      : None
+============================================================
+*/
+void runSortBenchmark(const SegmentedArray<Game>& games, const SlotMap& gameSlots) {
+    DynamicArray<int> live;
+    int gameCount = liveSlots(gameSlots, live);
+    if (gameCount <= 0) {
+        cout << "No games loaded to benchmark with." << endl;
+        return;
+    }
+
+    int n = BENCH_SORT_SIZE;
+    cout << "\nBuilding a catalog of " << n << " games..." << endl;
+    SegmentedArray<Game> big;
+    for (int i = 0; i < n; i++) {
+        Game& copy = big.add(games[live[i % gameCount]]);
+        for (int b = (i * 7) % 5; b > 0; b--) copy.incrementBorrowCount();
+    }
+
+    int* expectTitle = new int[n];
+    int* expectBorrows = new int[n];
+    int* order = new int[n];
+
+    GameSorter sorter;
+    sorter.setParallel(false);
+    double seqTitle = timeSort(sorter, big, expectTitle, n, SORT_BY_TITLE);
+    double seqBorrows = timeSort(sorter, big, expectBorrows, n, SORT_BY_BORROWS_DESC);
+
+    cout << fixed << setprecision(1);
+    cout << "\nThreads | Title sort (ms) | Speedup | Borrow sort (ms) | Speedup | Same result" << endl;
+    cout << "--------+-----------------+---------+------------------+---------+------------" << endl;
+    cout << "   seq  | " << setw(15) << seqTitle << " |    1.0x | "
+        << setw(16) << seqBorrows << " |    1.0x | -" << endl;
+
+    sorter.setParallel(true);
+    int maxThreads = hardwareThreadCount();
+    for (int threads = 1; ; threads *= 2) {
+        if (threads > maxThreads) threads = maxThreads;
+
+        TaskPool pool(threads);
+        sorter.setThreadPool(&pool);
+
+        double titleMs = timeSort(sorter, big, order, n, SORT_BY_TITLE);
+        bool same = sameOrder(order, expectTitle, n);
+        double borrowMs = timeSort(sorter, big, order, n, SORT_BY_BORROWS_DESC);
+        same = same && sameOrder(order, expectBorrows, n);
+
+        cout << setw(7) << threads << " | " << setw(15) << titleMs << " | "
+            << setw(6) << seqTitle / titleMs << "x | " << setw(16) << borrowMs << " | "
+            << setw(6) << seqBorrows / borrowMs << "x | " << (same ? "yes" : "NO") << endl;
+
+        sorter.setThreadPool(nullptr);
+        if (threads == maxThreads) break;
+    }
+    cout << defaultfloat;
+
+    delete[] order;
+    delete[] expectBorrows;
+    delete[] expectTitle;
+}
+
+// Lines and fields seen by one tokenizer run (the work done must match)
+struct CsvTally {
+    long long lines;
+    long long fields;
+    long long fieldBytes;   // sum of field end offsets, catches misplaced cuts
+};
+
+/*
+============================================================
+Function    : tokenizeByteLoop
+Description : The tokenizer the loader used before CsvScanner:
+              memchr to the end of each line, then one test
+              per byte for quotes and commas.
+Input       : data - CSV text (const char*)
+              length - Size in bytes (size_t)
+Return      : Lines and fields found (CsvTally)
+============================================================
+*/
+static CsvTally tokenizeByteLoop(const char* data, size_t length) {
+    CsvTally tally = { 0, 0, 0 };
+    const char* pos = data;
+    const char* end = data + length;
+    while (pos < end) {
+        const char* newline = (const char*)memchr(pos, '\n', end - pos);
+        const char* lineEnd = (newline == nullptr) ? end : newline;
+        int fields = 0;
+        bool inQuotes = false;
+        for (const char* p = pos; p < lineEnd; p++) {
+            if (*p == '"') {
+                inQuotes = !inQuotes;
+            }
+            else if (*p == ',' && !inQuotes) {
+                if (fields < CSV_MAX_FIELDS) tally.fieldBytes += p - data;
+                fields++;
+            }
+        }
+        if (fields < CSV_MAX_FIELDS) tally.fieldBytes += lineEnd - data;
+        fields++;
+        tally.fields += (fields < CSV_MAX_FIELDS) ? fields : CSV_MAX_FIELDS;
+        tally.lines++;
+        pos = (newline == nullptr) ? end : newline + 1;
+    }
+    return tally;
+}
+
+/*
+============================================================
+Function    : tokenizeScanner
+Description : Walks the same text with CsvScanner.
+Input       : data - CSV text (const char*)
+              length - Size in bytes (size_t)
+              useSimd - False for scalar mask building (bool)
+Return      : Lines and fields found (CsvTally)
+============================================================
+*/
+static CsvTally tokenizeScanner(const char* data, size_t length, bool useSimd) {
+    CsvTally tally = { 0, 0, 0 };
+    CsvScanner scanner(data, data + length, useSimd);
+    CsvLine line;
+    while (scanner.nextLine(line)) {
+        for (int f = 0; f < line.fieldCount; f++) tally.fieldBytes += line.fieldEnd[f] - data;
+        tally.fields += line.fieldCount;
+        tally.lines++;
+    }
+    return tally;
+}
+
+/*
+============================================================
+Function    : runCsvBenchmark
+Description : Generates a BENCH_CSV_BYTES catalog export in
+              memory from the loaded games (quoted titles, many
+              with commas inside) and times three tokenizers
+              over it: the old byte loop, CsvScanner with
+              scalar masks, and CsvScanner with SIMD masks.
+              Prints the best time and throughput in MB/s of
+              each and checks they find the same lines and
+              fields.
+Input       : games[] - Loaded catalog
+              gameSlots - Which slots hold a game (const SlotMap&)
+Return      : None
+============================================================
+*/
+void runCsvBenchmark(const SegmentedArray<Game>& games, const SlotMap& gameSlots) {
+    DynamicArray<int> live;
+    int gameCount = liveSlots(gameSlots, live);
+    if (gameCount <= 0) {
+        cout << "No games loaded to benchmark with." << endl;
+        return;
+    }
+
+    cout << "\nGenerating a " << (BENCH_CSV_BYTES >> 20) << " MB CSV export..." << endl;
+    string text;
+    text.reserve(BENCH_CSV_BYTES + 256);
+    text += "title,minPlayers,maxPlayers,maxPlaytime,minPlaytime,yearPublished\n";
+    for (int i = 0; (int)text.length() < BENCH_CSV_BYTES; i++) {
+        const Game& game = games[live[i % gameCount]];
+        text += '"';
+        text += game.getTitle();
+        text += "\",";
+        text += to_string(game.getMinPlayers()) + "," + to_string(game.getMaxPlayers()) + ",";
+        text += to_string(game.getMaxPlaytime()) + "," + to_string(game.getMinPlaytime()) + ",";
+        text += to_string(game.getYear()) + "\n";
+    }
+
+    const char* data = text.data();
+    size_t length = text.length();
+    double megabytes = length / (1024.0 * 1024.0);
+
+    const int TOKENIZERS = 3;
+    const char* names[TOKENIZERS] = { "byte loop", "scanner, scalar masks", "scanner, SIMD masks" };
+    double best[TOKENIZERS];
+    CsvTally tallies[TOKENIZERS];
+
+    for (int t = 0; t < TOKENIZERS; t++) {
+        for (int run = 0; run < BENCH_REPEATS; run++) {
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            if (t == 0) tallies[t] = tokenizeByteLoop(data, length);
+            else tallies[t] = tokenizeScanner(data, length, t == 2);
+            chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+
+            if (run == 0 || elapsed.count() < best[t]) best[t] = elapsed.count();
+        }
+    }
+
+    cout << "SIMD instruction set: " << csvSimdName() << endl;
+    cout << fixed << setprecision(1);
+    cout << "\nTokenizer              |  Time (ms) |     MB/s | Speedup | Same result" << endl;
+    cout << "-----------------------+------------+----------+---------+------------" << endl;
+    for (int t = 0; t < TOKENIZERS; t++) {
+        bool same = tallies[t].lines == tallies[0].lines && tallies[t].fields == tallies[0].fields &&
+            tallies[t].fieldBytes == tallies[0].fieldBytes;
+        cout << left << setw(22) << names[t] << right << " | " << setw(10) << best[t] << " | "
+            << setw(8) << megabytes / (best[t] / 1000.0) << " | " << setw(6) << best[0] / best[t]
+            << "x | " << (t == 0 ? "-" : (same ? "yes" : "NO")) << endl;
+    }
+    cout << defaultfloat;
+    cout << tallies[0].lines << " lines, " << tallies[0].fields << " fields" << endl;
+}
+
+/*
+============================================================
+Function    : runBorrowChurnBenchmark
+Description : Borrow/return churn on one member's borrowed
+              games: BENCH_CHURN_HELD games stay on loan while
+              each round borrows one more and returns the
+              oldest. Run once with every loan, including the
+              round's extra one, fitting inside the Member
+              (MEMBER_INLINE_BORROWS) and once with
+              BENCH_CHURN_HELD, which spills to the heap.
+              Reports the time and the global heap allocations
+              made by each run.
+Input       : None
+Return      : None
+============================================================
+*/
+void runBorrowChurnBenchmark() {
+    // Plain handles stand in for games: the set only compares them
+    const IdHandle IDS = 64;
+    const int heldCounts[2] = { MEMBER_INLINE_BORROWS - 1, BENCH_CHURN_HELD };
+
+    cout << "\nBorrow/return churn: " << BENCH_CHURN_ROUNDS << " rounds per run" << endl;
+    cout << left << setw(14) << "Games on loan" << right << " | " << setw(10) << "Time (ms)"
+        << " | " << setw(16) << "Heap allocations" << endl;
+    cout << "-------------------------------------------" << endl;
+
+    for (int run = 0; run < 2; run++) {
+        int held = heldCounts[run];
+        AllocationProbe probe;
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        {
+            Member member;
+            for (int i = 0; i < held; i++) {
+                member.addBorrowedGame((IdHandle)i);
+            }
+            for (int round = 0; round < BENCH_CHURN_ROUNDS; round++) {
+                member.addBorrowedGame((IdHandle)((round + held) % IDS));
+                member.removeBorrowedGame((IdHandle)(round % IDS));
+            }
+        }
+        chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+        long long heapAllocations = probe.allocations();
+
+        cout << fixed << setprecision(1);
+        cout << left << setw(14) << held << right << " | " << setw(10) << elapsed.count()
+            << " | " << setw(16) << heapAllocations << endl;
+        cout << defaultfloat;
+    }
+}
+
+/*
+============================================================
+Function    : runReadPathAllocationCheck
+Description : Counts the heap allocations of the read path.
+              First every live game is looked up by its ID
+              (a string_view into the Game, no temporary key)
+              and its fields are read through the reference
+              getters; this should allocate nothing. Then a
+              player-count search is run for 1 to
+              BENCH_SEARCH_MAX_PLAYERS players, reading every
+              result's fields like the results table does;
+              its only allocations should be the result set
+              growing to hold its output.
+Input       : games[] - Loaded catalog
+              gameSlots - Which slots hold a game (const SlotMap&)
+              gameHash - Game ID -> slot (const HashTable&)
+              catalog - Player-count buckets (const GameCatalog&)
+Return      : None
+============================================================
+*/
+void runReadPathAllocationCheck(const SegmentedArray<Game>& games, const SlotMap& gameSlots,
+    const HashTable& gameHash, const GameCatalog& catalog) {
+    DynamicArray<int> live;
+    int gameCount = liveSlots(gameSlots, live);
+    if (gameCount <= 0) {
+        cout << "No games loaded to check." << endl;
+        return;
+    }
+
+    // Lookups: the key is the stored ID, read in place
+    long long touched = 0;
+    int misses = 0;
+    AllocationProbe lookupProbe;
+    for (int i = 0; i < gameCount; i++) {
+        const Game& game = games[live[i]];
+        string_view id = game.getGameID();
+        if (gameHash.search(id) != live[i]) misses++;
+        touched += game.getTitle().length() + game.getStatus().length() + game.getYear();
+    }
+    long long lookupAllocations = lookupProbe.allocations();
+
+    cout << "\nRead-path heap allocations" << endl;
+    cout << "Lookups : " << gameCount << " games by ID, " << lookupAllocations
+        << " allocation(s)" << (misses > 0 ? " - LOOKUP MISMATCH" : "") << endl;
+
+    cout << "\nPlayers | Results | Allocations" << endl;
+    cout << "--------+---------+------------" << endl;
+    for (int players = 1; players <= BENCH_SEARCH_MAX_PLAYERS; players++) {
+        AllocationProbe searchProbe;
+        GameResultSet results(games);
+        const DynamicArray<int>* bucket = catalog.findByPlayerCount(players);
+        if (bucket != nullptr) {
+            for (int i = 0; i < bucket->size(); i++) results.add((*bucket)[i]);
+        }
+        for (int i = 0; i < results.size(); i++) {
+            const Game& game = results.at(i);
+            touched += game.getGameID().length() + game.getTitle().length() + game.getMinPlayers();
+        }
+        cout << setw(7) << players << " | " << setw(7) << results.size() << " | "
+            << setw(11) << searchProbe.allocations() << endl;
+    }
+    cout << "Search allocations come from the result set growing to hold its output." << endl;
+
+    // Keep the field reads from being optimised away
+    volatile long long sink = touched;
+    (void)sink;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "Game.h"
+#include "SlotMap.h"
+#include "SegmentedArray.h"
+#include "HashTable.h"
+#include "GameCatalog.h"
+
+const int BENCH_SORT_SIZE = 200000;   // games in the scaled-up catalog
+const int BENCH_REPEATS = 3;          // best of N runs is reported
+const int BENCH_CSV_BYTES = 64 << 20; // size of the generated CSV export
+const int BENCH_CHURN_ROUNDS = 200000; // borrow + return pairs per churn run
+const int BENCH_CHURN_HELD = 5;        // games on loan in the spilled churn run
+const int BENCH_SEARCH_MAX_PLAYERS = 12; // player counts searched by the read-path check
+
+// Performance benchmarks (admin menu)
+void runSortBenchmark(const SegmentedArray<Game>& games, const SlotMap& gameSlots);
+void runCsvBenchmark(const SegmentedArray<Game>& games, const SlotMap& gameSlots);
+void runBorrowChurnBenchmark();
+void runReadPathAllocationCheck(const SegmentedArray<Game>& games, const SlotMap& gameSlots,
+    const HashTable& gameHash, const GameCatalog& catalog);
@@ -12,8 +12,8 @@ Return      : None
 ============================================================
 */
 BorrowRecord::BorrowRecord() {
-    gameID = "";
-    memberID = "";
+    gameKey = NO_ID;
+    memberKey = NO_ID;
     borrowDate = "";
     returnDate = "";
     isReturned = false;
@@ -23,16 +23,16 @@ BorrowRecord::BorrowRecord() {
 ============================================================
 Function    : BorrowRecord (Parameterized Constructor)
 Description : Initializes a BorrowRecord object with the
-              provided game ID, member ID, and borrow date.
-Input       : gID - Game ID (string)
-              mID - Member ID (string)
+              provided game, member, and borrow date.
+Input       : gKey - Game handle (IdHandle)
+              mKey - Member handle (IdHandle)
               bDate - Borrow date (string)
 Return      : None
 ============================================================
 */
-BorrowRecord::BorrowRecord(string gID, string mID, string bDate) {
-    gameID = gID;
-    memberID = mID;
+BorrowRecord::BorrowRecord(IdHandle gKey, IdHandle mKey, string bDate) {
+    gameKey = gKey;
+    memberKey = mKey;
     borrowDate = bDate;
     returnDate = "";
     isReturned = false;
@@ -43,40 +43,60 @@ BorrowRecord::BorrowRecord(string gID, string mID, string bDate) {
 Function    : getGameID
 Description : Returns the game ID of this borrow record.
 Input       : None
-Return      : Game ID (string)
+Return      : Game ID (const string&)
 ============================================================
 */
-string BorrowRecord::getGameID() { return gameID; }
+const string& BorrowRecord::getGameID() const { return gameIds.name(gameKey); }
 
 /*
 ============================================================
 Function    : getMemberID
 Description : Returns the member ID of this borrow record.
 Input       : None
-Return      : Member ID (string)
+Return      : Member ID (const string&)
 ============================================================
 */
-string BorrowRecord::getMemberID() { return memberID; }
+const string& BorrowRecord::getMemberID() const { return memberIds.name(memberKey); }
+
+/*
+============================================================
+Function    : getGameKey
+Description : Returns the game handle of this borrow record.
+Input       : None
+Return      : Game handle (IdHandle)
+============================================================
+*/
+IdHandle BorrowRecord::getGameKey() const { return gameKey; }
+
+/*
+============================================================
+Function    : getMemberKey
+Description : Returns the member handle of this borrow record.
+Input       : None
+Return      : Member handle (IdHandle)
+============================================================
+*/
+IdHandle BorrowRecord::getMemberKey() const { return memberKey; }
 
 /*
 ============================================================
 Function    : getBorrowDate
 Description : Returns the borrow date of this record.
 Input       : None
-Return      : Borrow date (string)
+Return      : Borrow date (const string&)
 ============================================================
 */
-string BorrowRecord::getBorrowDate() { return borrowDate; }
+const string& BorrowRecord::getBorrowDate() const { return borrowDate; }
 
 /*
 ============================================================
 Function    : getReturnDate
 Description : Returns the return date of this record.
 Input       : None
-Return      : Return date (string, empty if not returned)
+Return      : Return date (const string&, empty if not returned)
 ============================================================
 */
-string BorrowRecord::getReturnDate() { return returnDate; }
+const string& BorrowRecord::getReturnDate() const { return returnDate; }
 
 /*
 ============================================================
@@ -86,7 +106,7 @@ Input       : None
 Return      : True if returned, false otherwise (bool)
 ============================================================
 */
-bool BorrowRecord::getIsReturned() { return isReturned; }
+bool BorrowRecord::getIsReturned() const { return isReturned; }
 
 /*
 ============================================================
@@ -96,7 +116,7 @@ Input       : rDate - Return date (string)
 Return      : None
 ============================================================
 */
-void BorrowRecord::setReturnDate(string rDate) {
+void BorrowRecord::setReturnDate(const string& rDate) {
     returnDate = rDate;
 }
 
@@ -124,7 +144,7 @@ Return      : None
 ============================================================
 */
 void BorrowRecord::display() {
-    cout << "Game: " << gameID << " | Member: " << memberID;
+    cout << "Game: " << getGameID() << " | Member: " << getMemberID();
     cout << " | Borrowed: " << borrowDate;
     if (isReturned) {
         cout << " | Returned: " << returnDate;
@@ -145,5 +165,5 @@ Return      : Formatted string (string)
 ============================================================
 */
 string BorrowRecord::toString() {
-    return gameID + "|" + memberID + "|" + borrowDate + "|" + returnDate;
+    return getGameID() + "|" + getMemberID() + "|" + borrowDate + "|" + returnDate;
 }
\ No newline at end of file
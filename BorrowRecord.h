@@ -1,11 +1,12 @@
 #pragma once
 #include <string>
+#include "IdInterner.h"
 using namespace std;
 
 class BorrowRecord {
 private:
-    string gameID;
-    string memberID;
+    IdHandle gameKey;
+    IdHandle memberKey;
     string borrowDate;
     string returnDate;
     bool isReturned;
@@ -13,17 +14,19 @@ private:
 public:
     // Constructor
     BorrowRecord();
-    BorrowRecord(string gID, string mID, string bDate);
+    BorrowRecord(IdHandle gKey, IdHandle mKey, string bDate);
 
     // Getters
-    string getGameID();
-    string getMemberID();
-    string getBorrowDate();
-    string getReturnDate();
-    bool getIsReturned();
+    const string& getGameID() const;
+    const string& getMemberID() const;
+    IdHandle getGameKey() const;
+    IdHandle getMemberKey() const;
+    const string& getBorrowDate() const;
+    const string& getReturnDate() const;
+    bool getIsReturned() const;
 
     // Setters
-    void setReturnDate(string rDate);
+    void setReturnDate(const string& rDate);
     void markAsReturned();
 
     // Display
@@ -0,0 +1,260 @@
+#include "CsvScanner.h"
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CSV_USE_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CSV_USE_SSE2
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+// ===================== BIT HELPERS =====================
+static int lowestBit(uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (int)index;
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+// Bit i = parity of bits 0..i: the quote state after byte i
+static uint64_t prefixXor(uint64_t x) {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+/*
+============================================================
+Function    : matchBytes
+Description : Finds every '"', ',' and '\n' in one block.
+              Uses 32-byte AVX2 or 16-byte SSE2 compares and
+              movemask when available; the scalar loop is the
+              fallback and the reference.
+Input       : data - CSV_BLOCK_BYTES bytes (const char*)
+              useSimd - False to force the scalar loop (bool)
+              quotes, commas, newlines - Receive the masks
+              (uint64_t&)
+Return      : None
+============================================================
+*/
+static void matchBytes(const char* data, bool useSimd, uint64_t& quotes, uint64_t& commas,
+    uint64_t& newlines) {
+    quotes = commas = newlines = 0;
+
+#if defined(CSV_USE_AVX2)
+    if (useSimd) {
+        const __m256i quote = _mm256_set1_epi8('"');
+        const __m256i comma = _mm256_set1_epi8(',');
+        const __m256i newline = _mm256_set1_epi8('\n');
+        for (int i = 0; i < CSV_BLOCK_BYTES; i += 32) {
+            __m256i bytes = _mm256_loadu_si256((const __m256i*)(data + i));
+            quotes |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, quote)) << i;
+            commas |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, comma)) << i;
+            newlines |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, newline)) << i;
+        }
+        return;
+    }
+#elif defined(CSV_USE_SSE2)
+    if (useSimd) {
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i newline = _mm_set1_epi8('\n');
+        for (int i = 0; i < CSV_BLOCK_BYTES; i += 16) {
+            __m128i bytes = _mm_loadu_si128((const __m128i*)(data + i));
+            quotes |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, quote)) << i;
+            commas |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, comma)) << i;
+            newlines |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline)) << i;
+        }
+        return;
+    }
+#else
+    (void)useSimd;
+#endif
+
+    for (int i = 0; i < CSV_BLOCK_BYTES; i++) {
+        uint64_t bit = (uint64_t)1 << i;
+        if (data[i] == '"') quotes |= bit;
+        else if (data[i] == ',') commas |= bit;
+        else if (data[i] == '\n') newlines |= bit;
+    }
+}
+
+/*
+============================================================
+Function    : buildCsvMasks
+Description : Classifies one block. The quoted region is the
+              prefix XOR of the quote mask, flipped if the
+              block starts inside quotes. That is only right
+              while no line ends inside quotes; if one does,
+              the region is rebuilt bit by bit, restarting the
+              quote state after each newline.
+Input       : data - CSV_BLOCK_BYTES bytes (const char*)
+              inQuotes - Quote state before the block (bool)
+              useSimd - False to force scalar matching (bool)
+              masks - Receives the masks (CsvBlockMasks&)
+Return      : None
+============================================================
+*/
+void buildCsvMasks(const char* data, bool inQuotes, bool useSimd, CsvBlockMasks& masks) {
+    uint64_t commas;
+    matchBytes(data, useSimd, masks.quotes, commas, masks.newlines);
+
+    uint64_t quoted = prefixXor(masks.quotes) ^ (inQuotes ? ~(uint64_t)0 : 0);
+    if (quoted & masks.newlines) {
+        quoted = 0;
+        bool state = inQuotes;
+        for (int i = 0; i < CSV_BLOCK_BYTES; i++) {
+            uint64_t bit = (uint64_t)1 << i;
+            if (masks.quotes & bit) state = !state;
+            if (masks.newlines & bit) state = false;
+            if (state) quoted |= bit;
+        }
+    }
+    masks.quoted = quoted;
+    masks.separators = commas & ~quoted;
+}
+
+/*
+============================================================
+Function    : csvSimdName
+Description : Names the instruction set the masks are built
+              with in this build.
+Input       : None
+Return      : "AVX2", "SSE2" or "scalar" (const char*)
+============================================================
+*/
+const char* csvSimdName() {
+#if defined(CSV_USE_AVX2)
+    return "AVX2";
+#elif defined(CSV_USE_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+// ===================== SCANNER =====================
+
+/*
+============================================================
+Function    : CsvScanner (Constructor)
+Description : Prepares to scan [begin, end), which must start
+              at the beginning of a line.
+Input       : begin - First byte (const char*)
+              end - End of the data (const char*)
+              useSimd - False to force scalar matching (bool)
+Return      : None
+============================================================
+*/
+CsvScanner::CsvScanner(const char* begin, const char* end, bool useSimd) {
+    this->cursor = begin;
+    this->end = end;
+    this->useSimd = useSimd;
+    inQuotes = false;
+    loadBlock(begin);
+}
+
+/*
+============================================================
+Function    : loadBlock
+Description : Builds the masks of the block starting at
+              'start'. The last, partial block is copied into
+              a zero-padded buffer first (zero bytes match
+              nothing).
+Input       : start - First byte of the block (const char*)
+Return      : False if there is no data left (bool)
+============================================================
+*/
+bool CsvScanner::loadBlock(const char* start) {
+    block = start;
+    structural = newlines = quotes = 0;
+    if (start >= end) return false;
+
+    CsvBlockMasks masks;
+    if (end - start >= CSV_BLOCK_BYTES) {
+        buildCsvMasks(start, inQuotes, useSimd, masks);
+    }
+    else {
+        char padded[CSV_BLOCK_BYTES];
+        memset(padded, 0, sizeof(padded));
+        memcpy(padded, start, end - start);
+        buildCsvMasks(padded, inQuotes, useSimd, masks);
+    }
+
+    inQuotes = (masks.quoted >> 63) != 0;
+    structural = masks.separators | masks.newlines;
+    newlines = masks.newlines;
+    quotes = masks.quotes;
+    return true;
+}
+
+/*
+============================================================
+Function    : nextLine
+Description : Finds the next line and where each of its first
+              CSV_MAX_FIELDS fields ends, by visiting only the
+              separator and newline bits of each block. A
+              field is flagged as quoted when a quote bit lies
+              inside it, so only those fields need unquoting.
+Input       : line - Receives the line (CsvLine&)
+Return      : False once the data is used up (bool)
+============================================================
+*/
+bool CsvScanner::nextLine(CsvLine& line) {
+    if (cursor >= end) return false;
+
+    line.begin = cursor;
+    line.fieldCount = 0;
+    bool fieldQuoted = false;
+
+    while (true) {
+        while (structural == 0) {
+            fieldQuoted = fieldQuoted || quotes != 0;
+            if (!loadBlock(block + CSV_BLOCK_BYTES)) {
+                // Last line, without a newline
+                if (line.fieldCount < CSV_MAX_FIELDS) {
+                    line.fieldEnd[line.fieldCount] = end;
+                    line.fieldQuoted[line.fieldCount] = fieldQuoted;
+                    line.fieldCount++;
+                }
+                line.end = end;
+                cursor = end;
+                return true;
+            }
+        }
+
+        int index = lowestBit(structural);
+        uint64_t bit = (uint64_t)1 << index;
+        fieldQuoted = fieldQuoted || (quotes & (bit - 1)) != 0;
+        quotes &= ~(bit | (bit - 1));
+        structural &= ~bit;
+
+        const char* position = block + index;
+        if (line.fieldCount < CSV_MAX_FIELDS) {
+            line.fieldEnd[line.fieldCount] = position;
+            line.fieldQuoted[line.fieldCount] = fieldQuoted;
+            line.fieldCount++;
+        }
+        fieldQuoted = false;
+
+        if (newlines & bit) {
+            line.end = position;
+            cursor = position + 1;
+            return true;
+        }
+    }
+}
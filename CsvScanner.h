@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+using namespace std;
+
+const int CSV_BLOCK_BYTES = 64;   // bytes summarised by one set of masks
+const int CSV_MAX_FIELDS = 8;     // field ends recorded per line; later fields are skipped
+
+// Structural bitmasks for one block: bit i describes byte i
+struct CsvBlockMasks {
+    uint64_t quotes;       // '"'
+    uint64_t quoted;       // bytes inside quotes (state after each byte)
+    uint64_t separators;   // ',' outside quotes
+    uint64_t newlines;     // '\n' (always ends a line, quoted or not)
+};
+
+// One line as found by CsvScanner
+struct CsvLine {
+    const char* begin;
+    const char* end;                         // the '\n', or the end of the data
+    int fieldCount;                          // fields recorded, at most CSV_MAX_FIELDS
+    const char* fieldEnd[CSV_MAX_FIELDS];    // separator or line end after each field
+    bool fieldQuoted[CSV_MAX_FIELDS];        // field contains a '"'
+};
+
+/*
+============================================================
+Class       : CsvScanner
+Description : Structural CSV tokenizer in the style of
+              simdcsv. Each 64-byte block is classified at
+              once (AVX2 or SSE2 compares + movemask where
+              the compiler targets them, a scalar loop
+              otherwise) into quote / comma / newline masks.
+              Quoted regions come from a prefix XOR of the
+              quote mask, carried from block to block, and
+              knock out the commas they contain. nextLine()
+              then only visits the set bits of the
+              separator and newline masks instead of testing
+              every byte.
+              The rules are those of the original parser:
+              every '\n' ends a line (quote state restarts on
+              each line), quotes toggle quoting, and a comma
+              outside quotes ends a field. A block in which a
+              line ends while still inside quotes is redone
+              with a scalar pass that restarts the state at
+              each newline.
+============================================================
+*/
+class CsvScanner {
+private:
+    const char* cursor;       // start of the next line
+    const char* end;
+    const char* block;        // block the masks below describe
+    bool useSimd;
+    bool inQuotes;            // quote state at the end of 'block'
+    uint64_t structural;      // unvisited separators and newlines in 'block'
+    uint64_t newlines;
+    uint64_t quotes;          // quotes in 'block' not yet passed
+
+    bool loadBlock(const char* start);
+
+public:
+    CsvScanner(const char* begin, const char* end, bool useSimd = true);
+
+    bool nextLine(CsvLine& line);
+};
+
+// Classifies one CSV_BLOCK_BYTES block given the quote state before it
+void buildCsvMasks(const char* data, bool inQuotes, bool useSimd, CsvBlockMasks& masks);
+
+// Instruction set used for the masks: "AVX2", "SSE2" or "scalar"
+const char* csvSimdName();
@@ -7,11 +7,22 @@ Group:        Team 5
 Student IDs:  S10269080A, S10266834C
 ============================================================
 Features Highlighted:
-- Hash Table for O(1) game lookup by Game ID
-- Linked List to store each member's borrowed games
-- Merge Sort with user-selectable sort key (Year / Title)
-- Game Reviews: write, display, average rating
+- Hash Table for O(1) game lookup by Game ID and member lookup by Member ID
+- Game/Member IDs interned to dense integer handles for all records
+- Slot map for games: removing one is O(1) and no other game moves
+- Games, members, records, reviews and play sessions in segmented arrays
+  that grow with use and never move an element
+- Small inline set of each member's borrowed games (heap only past 4)
+- Merge Sort over index permutations with precomputed keys (Year / Title),
+  parallel on a work-stealing thread pool for large inputs
+- Year / title / borrow-count views maintained incrementally in the catalog
+- Game Reviews: write, display, average rating (per-game index, O(1) average)
 - Full borrow/return summary for members and admin
+- Memory-mapped CSV loading with a SIMD structural tokenizer, parallel for
+  large files
+- Reload of games.csv while running, applied as a diff (loans are kept)
+- Write-ahead journal with checksums and group commit, replayed at startup
+- Binary snapshots for fast startup, with journal compaction
 - Advanced Feature (Ethan): Record game play session (players + winner)
 ============================================================
 */
@@ -27,45 +38,55 @@ Features Highlighted:
 #include "BorrowRecord.h"
 #include "Review.h"
 #include "Admin.h"
+#include "IdInterner.h"
+#include "GameCatalog.h"
+#include "GameResultSet.h"
+#include "ReviewIndex.h"
+#include "LoanIndex.h"
+#include "MemberHistory.h"
+#include "Journal.h"
+#include "Benchmark.h"
+#include "SlotMap.h"
+#include "SegmentedArray.h"
 
 using namespace std;
 
 // ============= GLOBAL STORAGE =============
-const int MAX_GAMES = 1000;
-const int MAX_MEMBERS = 100;
-const int MAX_RECORDS = 1000;
-const int MAX_REVIEWS = 1000;
+// Segmented arrays: they grow as items are added, and an item never
+// moves once stored, so positions and references to it stay valid
+SegmentedArray<Game>         games;     // one per slot of gameSlots
+SegmentedArray<Member>       members;
+SegmentedArray<BorrowRecord> records;
+SegmentedArray<Review>       reviews;
 
-Game         games[MAX_GAMES];
-Member       members[MAX_MEMBERS];
-BorrowRecord records[MAX_RECORDS];
-Review       reviews[MAX_REVIEWS];
-
-int gameCount = 0;
-int memberCount = 0;
-int recordCount = 0;
-int reviewCount = 0;
+SlotMap gameSlots;   // which games[] slots hold a game (removal leaves a hole)
 
 // ============= ADVANCED FEATURE: PLAY RECORDING (ARRAY) =============
-const int MAX_PLAY_RECORDS = 2000;
 const int MAX_SESSION_PLAYERS = 8;
 
 struct PlayRecord {
-    string gameID;
+    IdHandle gameKey;
     int numPlayers;
-    string playerIDs[MAX_SESSION_PLAYERS];
-    string winnerID;
-    string recordedBy;
+    IdHandle playerKeys[MAX_SESSION_PLAYERS];
+    IdHandle winnerKey;
+    IdHandle recordedByKey;
     string timestamp;   // YYYY-MM-DD HH:MM
 };
 
-PlayRecord playRecords[MAX_PLAY_RECORDS];
-int playRecordCount = 0;
+SegmentedArray<PlayRecord> playRecords;
 
 HashTable gameHash;
-
-// ============= SORT MODE ENUM =============
-enum SortMode { SORT_BY_YEAR, SORT_BY_TITLE };
+HashMap<string, int> memberHash;   // Member ID -> index in members[]
+GameCatalog catalog;               // columnar copy of games[] for scans
+ReviewIndex reviewIndex;           // per-game reviews and rating totals
+LoanIndex loans;                   // open BorrowRecord per game
+MemberHistory history;             // BorrowRecord slots per member
+
+// ============= WRITE-AHEAD LOG =============
+const char* const GAMES_FILE = "games.csv";
+const char* const JOURNAL_FILE = "library.journal";
+const char* const SNAPSHOT_FILE = "library.snapshot";
+Journal journal;                   // every mutation, replayed at startup
 
 // ============= HELPER FUNCTIONS =============
 
@@ -117,43 +138,41 @@ void pauseScreen() {
 /*
 ============================================================
 Function    : findMember
-Description : Performs a linear search through the members
-              array to locate a member by their ID.
-Input       : string memberID - the ID to search for
+Description : Locates a member by their ID through the member
+              hash index in O(1).
+Input       : const string& memberID - the ID to search for
 Return      : int - index in members[] if found, -1 otherwise
 ============================================================
 */
-int findMember(string memberID) {
-    for (int i = 0; i < memberCount; i++) {
-        if (members[i].getMemberID() == memberID) {
-            return i;
-        }
-    }
-    return -1;
+int findMember(const string& memberID) {
+    return memberHash.search(memberID);
 }
 
 /*
 ============================================================
 Function    : calculateAverageRating
-Description : Scans the global reviews[] array and computes
-              the average rating for a given game.
-Input       : string gameID - the game to average
+Description : Returns the average rating for a given game
+              from the running totals in the review index, in
+              constant time.
+Input       : IdHandle gameKey - the game to average
 Return      : double - average rating (0.0 if no reviews)
 ============================================================
 */
-double calculateAverageRating(string gameID) {
-    int totalRating = 0;
-    int count = 0;
-
-    for (int i = 0; i < reviewCount; i++) {
-        if (reviews[i].getGameID() == gameID) {
-            totalRating += reviews[i].getRating();
-            count++;
-        }
-    }
+double calculateAverageRating(IdHandle gameKey) {
+    return reviewIndex.averageRating(gameKey);
+}
 
-    if (count == 0) return 0.0;
-    return (double)totalRating / count;
+/*
+============================================================
+Function    : calculateAverageRating
+Description : Resolves a game ID typed by the user to its
+              handle and averages its ratings.
+Input       : const string& gameID - the game to average
+Return      : double - average rating (0.0 if no reviews)
+============================================================
+*/
+double calculateAverageRating(const string& gameID) {
+    return calculateAverageRating(gameIds.find(gameID));
 }
 
 // ============= ADVANCED FEATURE: PLAY RECORDING FUNCTIONS =============
@@ -208,6 +227,51 @@ bool isInPlayersList(const string players[], int n, const string& id) {
     return false;
 }
 
+/*
+============================================================
+Function    : isValidPlaySession
+Description : The rules a play session must meet, shared by
+              recordPlaySession and journal replay: the game
+              exists and allows n players, every player exists
+              and appears once, and the winner is one of them.
+Input       : const string& gameID - game played
+              const string players[] - player IDs
+              int n - number of players
+              const string& winner - winner's ID
+              string* error - receives the message for the
+              first rule broken, may be nullptr
+Return      : bool - true if the session is valid
+============================================================
+*/
+bool isValidPlaySession(const string& gameID, const string players[], int n, const string& winner,
+    string* error = nullptr) {
+    string message;
+    int minP, maxP;
+    if (!getGameMinMaxPlayers(gameID, minP, maxP)) {
+        message = "ERROR: Game not found!";
+    }
+    else if (n < minP || n > maxP || n > MAX_SESSION_PLAYERS) {
+        message = "ERROR: Invalid number of players.";
+    }
+    for (int i = 0; message.empty() && i < n; i++) {
+        if (!memberExistsByID(players[i])) {
+            message = "ERROR: Member ID not found.";
+        }
+        for (int j = 0; message.empty() && j < i; j++) {
+            if (players[j] == players[i]) message = "ERROR: Duplicate Member ID entered.";
+        }
+    }
+    if (message.empty() && !memberExistsByID(winner)) {
+        message = "ERROR: Winner Member ID not found.";
+    }
+    else if (message.empty() && !isInPlayersList(players, n, winner)) {
+        message = "ERROR: Winner must be one of the players entered.";
+    }
+
+    if (error != nullptr) *error = message;
+    return message.empty();
+}
+
 /*
 ============================================================
 Function    : getCurrentTimestamp
@@ -230,20 +294,15 @@ string getCurrentTimestamp() {
 ============================================================
 Function    : recordPlaySession
 Description : Records a game play session with multiple
-              players and a winner. Validates game exists,
-              player count is valid, all players exist,
-              no duplicate players, and winner is a player.
-              Stores record in playRecords[] array.
+              players and a winner. Once the input is in, it
+              is checked by isValidPlaySession, the same rules
+              journal replay applies. Stores record in
+              playRecords[] array and logs it to the journal.
 Input       : const string& currentMemberID - who is recording
 Return      : None
 ============================================================
 */
 void recordPlaySession(const string& currentMemberID) {
-    if (playRecordCount >= MAX_PLAY_RECORDS) {
-        cout << "ERROR: Play record storage is full.\n";
-        return;
-    }
-
     cout << "\n=== Record Game Play Session ===\n";
 
     string gameID;
@@ -266,7 +325,9 @@ void recordPlaySession(const string& currentMemberID) {
     }
     clearInputBuffer();
 
-    if (n < minP || n > maxP || n > MAX_SESSION_PLAYERS) {
+    // The range itself is checked with the rest of the session;
+    // this only keeps n within the players array
+    if (n < 1 || n > MAX_SESSION_PLAYERS) {
         cout << "ERROR: Invalid number of players.\n";
         return;
     }
@@ -277,18 +338,6 @@ void recordPlaySession(const string& currentMemberID) {
         cout << "Enter Member ID for Player " << (i + 1) << ": ";
         cin >> players[i];
         clearInputBuffer();
-
-        if (!memberExistsByID(players[i])) {
-            cout << "ERROR: Member ID not found.\n";
-            return;
-        }
-
-        for (int j = 0; j < i; j++) {
-            if (players[j] == players[i]) {
-                cout << "ERROR: Duplicate Member ID entered.\n";
-                return;
-            }
-        }
     }
 
     string winner;
@@ -296,25 +345,30 @@ void recordPlaySession(const string& currentMemberID) {
     cin >> winner;
     clearInputBuffer();
 
-    if (!memberExistsByID(winner)) {
-        cout << "ERROR: Winner Member ID not found.\n";
-        return;
-    }
-
-    if (!isInPlayersList(players, n, winner)) {
-        cout << "ERROR: Winner must be one of the players entered.\n";
+    string error;
+    if (!isValidPlaySession(gameID, players, n, winner, &error)) {
+        cout << error << "\n";
         return;
     }
 
     PlayRecord pr;
-    pr.gameID = gameID;
+    pr.gameKey = gameIds.find(gameID);
     pr.numPlayers = n;
-    for (int i = 0; i < n; i++) pr.playerIDs[i] = players[i];
-    pr.winnerID = winner;
-    pr.recordedBy = currentMemberID;
+    for (int i = 0; i < n; i++) pr.playerKeys[i] = memberIds.find(players[i]);
+    pr.winnerKey = memberIds.find(winner);
+    pr.recordedByKey = memberIds.find(currentMemberID);
     pr.timestamp = getCurrentTimestamp();
 
-    playRecords[playRecordCount++] = pr;
+    playRecords.add(pr);
+
+    JournalEntry entry(JOURNAL_PLAY);
+    entry.putString(gameID);
+    entry.putInt(n);
+    for (int i = 0; i < n; i++) entry.putString(players[i]);
+    entry.putString(winner);
+    entry.putString(currentMemberID);
+    entry.putString(pr.timestamp);
+    journal.append(entry);
 
     cout << "SUCCESS: Play session recorded.\n";
 }
@@ -331,15 +385,16 @@ Return      : None
 void viewMyPlayHistory(const string& memberID) {
     cout << "\n=== My Play History (" << memberID << ") ===\n";
     bool found = false;
+    IdHandle memberKey = memberIds.find(memberID);
 
-    for (int i = 0; i < playRecordCount; i++) {
+    for (int i = 0; i < playRecords.size() && memberKey != NO_ID; i++) {
         for (int p = 0; p < playRecords[i].numPlayers; p++) {
-            if (playRecords[i].playerIDs[p] == memberID) {
+            if (playRecords[i].playerKeys[p] == memberKey) {
                 found = true;
                 cout << playRecords[i].timestamp
-                    << " | Game: " << playRecords[i].gameID
-                    << " | Winner: " << playRecords[i].winnerID
-                    << " | Recorded By: " << playRecords[i].recordedBy << "\n";
+                    << " | Game: " << gameIds.name(playRecords[i].gameKey)
+                    << " | Winner: " << memberIds.name(playRecords[i].winnerKey)
+                    << " | Recorded By: " << memberIds.name(playRecords[i].recordedByKey) << "\n";
                 break;
             }
         }
@@ -367,20 +422,21 @@ void viewGamePlayHistory() {
     clearInputBuffer();
 
     bool found = false;
+    IdHandle gameKey = gameIds.find(gameID);
     cout << "\n=== Play History for Game " << gameID << " ===\n";
 
-    for (int i = 0; i < playRecordCount; i++) {
-        if (playRecords[i].gameID == gameID) {
+    for (int i = 0; i < playRecords.size() && gameKey != NO_ID; i++) {
+        if (playRecords[i].gameKey == gameKey) {
             found = true;
             cout << playRecords[i].timestamp
-                << " | Winner: " << playRecords[i].winnerID
+                << " | Winner: " << memberIds.name(playRecords[i].winnerKey)
                 << " | Players: ";
 
             for (int p = 0; p < playRecords[i].numPlayers; p++) {
-                cout << playRecords[i].playerIDs[p];
+                cout << memberIds.name(playRecords[i].playerKeys[p]);
                 if (p != playRecords[i].numPlayers - 1) cout << ", ";
             }
-            cout << " | Recorded By: " << playRecords[i].recordedBy << "\n";
+            cout << " | Recorded By: " << memberIds.name(playRecords[i].recordedByKey) << "\n";
         }
     }
 
@@ -389,19 +445,50 @@ void viewGamePlayHistory() {
 
 // ============= BORROW / RETURN FUNCTIONS =============
 
+/*
+============================================================
+Function    : applyBorrow
+Description : Carries out a borrow that has already been
+              validated: updates the game status, the member's
+              borrowed-game list and the catalog, and appends
+              a new BorrowRecord, registering it as the game's
+              open loan. Shared by borrowGame and journal
+              replay, so it prints nothing.
+Input       : int memberIndex - borrower's index in members[]
+              int gameIndex - game's index in games[]
+              const string& date - borrow date
+Return      : None
+============================================================
+*/
+void applyBorrow(int memberIndex, int gameIndex, const string& date) {
+    IdHandle memberKey = members[memberIndex].getMemberKey();
+    IdHandle gameKey = games[gameIndex].getGameKey();
+
+    games[gameIndex].setStatus("Borrowed");
+    games[gameIndex].setBorrowedBy(memberKey);
+    games[gameIndex].incrementBorrowCount();
+    catalog.update(gameIndex, games[gameIndex]);
+
+    members[memberIndex].addBorrowedGame(gameKey);
+
+    int slot = records.size();
+    records.add(BorrowRecord(gameKey, memberKey, date));
+    loans.open(gameKey, slot);
+    history.addRecord(slot, memberKey);
+}
+
 /*
 ============================================================
 Function    : borrowGame
 Description : Validates that both the member and game exist,
-              checks the game is available, then updates the
-              game status, the member's borrowed-game list,
-              and appends a new BorrowRecord.
-Input       : string memberID - borrower's ID
-              string gameID - game to borrow
+              checks the game is available, then applies the
+              borrow and logs it to the journal.
+Input       : const string& memberID - borrower's ID
+              const string& gameID - game to borrow
 Return      : bool - true if borrow succeeded, false otherwise
 ============================================================
 */
-bool borrowGame(string memberID, string gameID) {
+bool borrowGame(const string& memberID, const string& gameID) {
     int memberIndex = findMember(memberID);
     if (memberIndex == -1) {
         cout << "ERROR: Member " << memberID << " not found!" << endl;
@@ -420,14 +507,14 @@ bool borrowGame(string memberID, string gameID) {
         return false;
     }
 
-    games[gameIndex].setStatus("Borrowed");
-    games[gameIndex].setBorrowedBy(memberID);
-    games[gameIndex].incrementBorrowCount();
+    string date = getCurrentDate();
+    applyBorrow(memberIndex, gameIndex, date);
 
-    members[memberIndex].addBorrowedGame(gameID);
-
-    records[recordCount] = BorrowRecord(gameID, memberID, getCurrentDate());
-    recordCount++;
+    JournalEntry entry(JOURNAL_BORROW);
+    entry.putString(memberID);
+    entry.putString(gameID);
+    entry.putString(date);
+    journal.append(entry);
 
     cout << "\nSUCCESS: " << members[memberIndex].getName()
         << " borrowed \"" << games[gameIndex].getTitle() << "\"" << endl;
@@ -435,18 +522,48 @@ bool borrowGame(string memberID, string gameID) {
     return true;
 }
 
+/*
+============================================================
+Function    : applyReturn
+Description : Carries out a validated return: updates the game
+              status, the member's borrowed set and the catalog,
+              and marks the game's open BorrowRecord (found in
+              O(1) through the loan index) as returned. Shared
+              by returnGame and journal replay.
+Input       : int gameIndex - game's index in games[]
+              int memberIndex - borrower's index in members[]
+              const string& date - return date
+Return      : None
+============================================================
+*/
+void applyReturn(int gameIndex, int memberIndex, const string& date) {
+    IdHandle gameKey = games[gameIndex].getGameKey();
+
+    games[gameIndex].setStatus("Available");
+    games[gameIndex].setBorrowedBy(NO_ID);
+    catalog.update(gameIndex, games[gameIndex]);
+
+    members[memberIndex].removeBorrowedGame(gameKey);
+
+    int recordSlot = loans.close(gameKey);
+    if (recordSlot != -1) {
+        records[recordSlot].setReturnDate(date);
+        records[recordSlot].markAsReturned();
+        history.markReturned(records[recordSlot].getMemberKey());
+    }
+}
+
 /*
 ============================================================
 Function    : returnGame
 Description : Validates the game exists and is currently
-              borrowed, then updates the game status, the
-              member's linked list, and marks the matching
-              BorrowRecord as returned with today's date.
-Input       : string gameID - game to return
+              borrowed, then applies the return with today's
+              date and logs it to the journal.
+Input       : const string& gameID - game to return
 Return      : bool - true if return succeeded, false otherwise
 ============================================================
 */
-bool returnGame(string gameID) {
+bool returnGame(const string& gameID) {
     int gameIndex = gameHash.search(gameID);
     if (gameIndex == -1) {
         cout << "ERROR: Game " << gameID << " not found!" << endl;
@@ -458,27 +575,20 @@ bool returnGame(string gameID) {
         return false;
     }
 
-    string memberID = games[gameIndex].getBorrowedBy();
-    int memberIndex = findMember(memberID);
+    IdHandle memberKey = games[gameIndex].getBorrowerKey();
+    int memberIndex = findMember(memberIds.name(memberKey));
     if (memberIndex == -1) {
         cout << "ERROR: Member not found!" << endl;
         return false;
     }
 
-    games[gameIndex].setStatus("Available");
-    games[gameIndex].setBorrowedBy("");
-
-    members[memberIndex].removeBorrowedGame(gameID);
+    string date = getCurrentDate();
+    applyReturn(gameIndex, memberIndex, date);
 
-    for (int i = recordCount - 1; i >= 0; i--) {
-        if (records[i].getGameID() == gameID &&
-            records[i].getMemberID() == memberID &&
-            !records[i].getIsReturned()) {
-            records[i].setReturnDate(getCurrentDate());
-            records[i].markAsReturned();
-            break;
-        }
-    }
+    JournalEntry entry(JOURNAL_RETURN);
+    entry.putString(gameID);
+    entry.putString(date);
+    journal.append(entry);
 
     cout << "\nSUCCESS: " << members[memberIndex].getName()
         << " returned \"" << games[gameIndex].getTitle() << "\"" << endl;
@@ -493,11 +603,11 @@ bool returnGame(string gameID) {
 Function    : displayGameDetails
 Description : Looks up a game by ID via the hash table and
               calls its display() method.
-Input       : string gameID - the game to display
+Input       : const string& gameID - the game to display
 Return      : None
 ============================================================
 */
-void displayGameDetails(string gameID) {
+void displayGameDetails(const string& gameID) {
     int index = gameHash.search(gameID);
     if (index == -1) {
         cout << "Game not found!" << endl;
@@ -506,107 +616,39 @@ void displayGameDetails(string gameID) {
     games[index].display();
 }
 
-/*
-============================================================
-Function    : merge
-Description : The merge step of Merge Sort. Merges two
-              sorted sub-arrays according to the sort mode.
-Input       : Game arr[] - array being sorted
-              int left - start index
-              int mid - midpoint index
-              int right - end index
-              SortMode mode - which key to compare on
-Return      : None
-============================================================
-*/
-void merge(Game arr[], int left, int mid, int right, SortMode mode) {
-    int n1 = mid - left + 1;
-    int n2 = right - mid;
-
-    Game* L = new Game[n1];
-    Game* R = new Game[n2];
-
-    for (int i = 0; i < n1; i++) L[i] = arr[left + i];
-    for (int j = 0; j < n2; j++) R[j] = arr[mid + 1 + j];
-
-    int i = 0, j = 0, k = left;
-
-    while (i < n1 && j < n2) {
-        bool takeLeft = false;
-
-        if (mode == SORT_BY_YEAR) {
-            // Ascending by year; break ties alphabetically by title
-            if (L[i].getYear() < R[j].getYear())
-                takeLeft = true;
-            else if (L[i].getYear() == R[j].getYear())
-                takeLeft = (L[i].getTitle() <= R[j].getTitle());
-            else
-                takeLeft = false;
-        }
-        else {   // SORT_BY_TITLE
-            // Ascending alphabetical by title
-            takeLeft = (L[i].getTitle() <= R[j].getTitle());
-        }
-
-        if (takeLeft) { arr[k] = L[i]; i++; }
-        else { arr[k] = R[j]; j++; }
-        k++;
-    }
-
-    while (i < n1) { arr[k] = L[i]; i++; k++; }
-    while (j < n2) { arr[k] = R[j]; j++; k++; }
-
-    delete[] L;
-    delete[] R;
-}
-
-/*
-============================================================
-Function    : mergeSort
-Description : Recursive Merge Sort. Divides arr[left..right]
-              in half, sorts each half, then merges.
-Input       : Game arr[] - array being sorted
-              int left - start index of sub-array
-              int right - end index of sub-array
-              SortMode mode - which key to compare on
-Return      : None
-============================================================
-*/
-void mergeSort(Game arr[], int left, int right, SortMode mode) {
-    if (left < right) {
-        int mid = left + (right - left) / 2;
-        mergeSort(arr, left, mid, mode);
-        mergeSort(arr, mid + 1, right, mode);
-        merge(arr, left, mid, right, mode);
-    }
-}
-
 /*
 ============================================================
 Function    : searchByPlayerCount
-Description : Linear scan through games[] collecting every
-              game whose player range includes numPlayers.
-              Results are copied into the caller-supplied
-              results[] array (up to maxResults entries).
-              Does NOT sort - the caller chooses sort order.
+Description : Enumerates the prebuilt player-count bucket
+              (or, for counts outside the indexed range, runs
+              the vectorised filter over the catalog columns)
+              and adds the position of every matching game to
+              the result set, in catalog order. No Game is
+              copied. Does NOT sort - the caller chooses sort
+              order.
 Input       : int numPlayers - target player count
-              Game results[] - output array for matches
-              int maxResults - capacity of results[]
-Return      : int - number of games stored in results[]
+              GameResultSet& results - receives the matches
+Return      : int - number of matches
 ============================================================
 */
-int searchByPlayerCount(int numPlayers, Game results[], int maxResults) {
-    int count = 0;
-
-    for (int i = 0; i < gameCount && count < maxResults; i++) {
-        if (games[i].getMinPlayers() <= numPlayers &&
-            games[i].getMaxPlayers() >= numPlayers) {
-            results[count] = games[i];
-            count++;
+int searchByPlayerCount(int numPlayers, GameResultSet& results) {
+    results.clear();
+
+    const DynamicArray<int>* bucket = catalog.findByPlayerCount(numPlayers);
+    if (bucket != nullptr) {
+        for (int i = 0; i < bucket->size(); i++) {
+            results.add((*bucket)[i]);
         }
+        return results.size();
     }
 
-    return count;
+    int* matches = new int[catalog.size() + 1];
+    int found = catalog.filterByPlayerCount(numPlayers, matches);
+    for (int i = 0; i < found; i++) {
+        results.add(matches[i]);
+    }
+    delete[] matches;
+    return results.size();
 }
 
 /*
@@ -614,13 +656,14 @@ int searchByPlayerCount(int numPlayers, Game results[], int maxResults) {
 Function    : displaySearchResults
 Description : Prints the search-results table with columns
               for ID, Title, Year, Players, Avg Rating and
-              Status.
-Input       : Game results[] - array of games to display
-              int count - number of valid entries
+              Status, reading each game in place through the
+              result set.
+Input       : const GameResultSet& results - games to display
 Return      : None
 ============================================================
 */
-void displaySearchResults(Game results[], int count) {
+void displaySearchResults(const GameResultSet& results) {
+    int count = results.size();
     if (count == 0) {
         cout << "No games found." << endl;
         return;
@@ -632,23 +675,19 @@ void displaySearchResults(Game results[], int count) {
     cout << "---------------------------------------------------------------------------------" << endl;
 
     for (int i = 0; i < count; i++) {
-        cout << results[i].getGameID() << " | ";
+        const Game& game = results.at(i);
+        cout << game.getGameID() << " | ";
 
-        string title = results[i].getTitle();
-        if (title.length() > 34) {
-            title = title.substr(0, 31) + "...";
-        }
-        cout << title;
-        for (int j = (int)title.length(); j < 34; j++) cout << " ";
+        printColumn(game.getTitle(), 34);
 
-        cout << " | " << results[i].getYear() << " | ";
+        cout << " | " << game.getYear() << " | ";
 
-        cout << results[i].getMinPlayers() << "-" << results[i].getMaxPlayers();
-        if (results[i].getMaxPlayers() < 10) cout << "  ";
+        cout << game.getMinPlayers() << "-" << game.getMaxPlayers();
+        if (game.getMaxPlayers() < 10) cout << "  ";
         else cout << " ";
 
         cout << " |    ";
-        double avg = calculateAverageRating(results[i].getGameID());
+        double avg = calculateAverageRating(game.getGameKey());
         if (avg > 0.0) {
             int whole = (int)avg;
             int fraction = (int)((avg - whole) * 10 + 0.5);
@@ -660,26 +699,53 @@ void displaySearchResults(Game results[], int count) {
             cout << "  N/A      ";
         }
 
-        cout << " | " << results[i].getStatus() << endl;
+        cout << " | " << game.getStatus() << endl;
     }
     cout << "---------------------------------------------------------------------------------" << endl;
 }
 
 // ============= REVIEW FUNCTIONS =============
 
+/*
+============================================================
+Function    : applyReview
+Description : Stores a validated Review in the global reviews[]
+              and registers it in the per-game review index.
+              Shared by addReview and journal replay.
+Input       : int memberIndex - reviewer's index in members[]
+              int gameIndex - game's index in games[]
+              int rating - score 1-10
+              const string& reviewText - the review body
+              const string& date - review date
+Return      : None
+============================================================
+*/
+void applyReview(int memberIndex, int gameIndex, int rating, const string& reviewText, const string& date) {
+    int position = reviews.size();
+    reviews.add(Review(
+        games[gameIndex].getGameKey(),
+        members[memberIndex].getMemberKey(),
+        members[memberIndex].getName(),
+        rating,
+        reviewText,
+        date
+    ));
+    reviewIndex.addReview(position, games[gameIndex].getGameKey(), rating);
+}
+
 /*
 ============================================================
 Function    : addReview
 Description : Validates rating range, member and game, then
-              stores a new Review in the global reviews[].
-Input       : string memberID - reviewer's member ID
-              string gameID - game being reviewed
+              applies the review and logs it to the journal.
+Input       : const string& memberID - reviewer's member ID
+              const string& gameID - game being reviewed
               int rating - score 1-10
-              string reviewText - the review body
+              const string& reviewText - the review body
 Return      : bool - true if review was saved, false on error
 ============================================================
 */
-bool addReview(string memberID, string gameID, int rating, string reviewText) {
+bool addReview(const string& memberID, const string& gameID, int rating, const string& reviewText) {
     if (rating < 1 || rating > 10) {
         cout << "ERROR: Rating must be between 1 and 10!" << endl;
         return false;
@@ -697,15 +763,16 @@ bool addReview(string memberID, string gameID, int rating, string reviewText) {
         return false;
     }
 
-    reviews[reviewCount] = Review(
-        gameID,
-        memberID,
-        members[memberIndex].getName(),
-        rating,
-        reviewText,
-        getCurrentDate()
-    );
-    reviewCount++;
+    string date = getCurrentDate();
+    applyReview(memberIndex, gameIndex, rating, reviewText, date);
+
+    JournalEntry entry(JOURNAL_REVIEW);
+    entry.putString(memberID);
+    entry.putString(gameID);
+    entry.putInt(rating);
+    entry.putString(reviewText);
+    entry.putString(date);
+    journal.append(entry);
 
     cout << "\nSUCCESS: Review added for \"" << games[gameIndex].getTitle() << "\"" << endl;
     return true;
@@ -715,12 +782,13 @@ bool addReview(string memberID, string gameID, int rating, string reviewText) {
 ============================================================
 Function    : displayReviewsForGame
 Description : Prints every review stored for the given game,
-              followed by the computed average rating.
-Input       : string gameID - the game whose reviews to show
+              following its chain in the review index, then
+              the average rating.
+Input       : const string& gameID - the game whose reviews to show
 Return      : None
 ============================================================
 */
-void displayReviewsForGame(string gameID) {
+void displayReviewsForGame(const string& gameID) {
     int gameIndex = gameHash.search(gameID);
     if (gameIndex == -1) {
         cout << "ERROR: Game not found!" << endl;
@@ -731,22 +799,18 @@ void displayReviewsForGame(string gameID) {
     cout << "Reviews for: " << games[gameIndex].getTitle() << endl;
     cout << "======================================" << endl;
 
-    int count = 0;
-    int totalRating = 0;
+    IdHandle gameKey = games[gameIndex].getGameKey();
 
-    for (int i = 0; i < reviewCount; i++) {
-        if (reviews[i].getGameID() == gameID) {
-            reviews[i].display();
-            totalRating += reviews[i].getRating();
-            count++;
-        }
+    for (int i = reviewIndex.firstReview(gameKey); i != -1; i = reviewIndex.nextReviewOf(i)) {
+        reviews[i].display();
     }
 
+    int count = reviewIndex.reviewCount(gameKey);
     if (count == 0) {
         cout << "No reviews yet for this game." << endl;
     }
     else {
-        double avgRating = (double)totalRating / count;
+        double avgRating = reviewIndex.averageRating(gameKey);
         cout << "\nAverage Rating: " << avgRating << "/10 (" << count << " reviews)" << endl;
     }
 }
@@ -757,13 +821,14 @@ void displayReviewsForGame(string gameID) {
 ============================================================
 Function    : displayMemberSummary
 Description : Shows a full borrow/return history for one
-              member. Scans records[] and prints each
-              transaction.
-Input       : string memberID - the member whose summary to show
+              member. Follows the member's posting list, so
+              only their own records are visited, and takes
+              the totals from the cached counts.
+Input       : const string& memberID - the member whose summary to show
 Return      : None
 ============================================================
 */
-void displayMemberSummary(string memberID) {
+void displayMemberSummary(const string& memberID) {
     int memberIndex = findMember(memberID);
     if (memberIndex == -1) {
         cout << "ERROR: Member not found!" << endl;
@@ -775,40 +840,28 @@ void displayMemberSummary(string memberID) {
         << members[memberIndex].getName() << endl;
     cout << "======================================" << endl;
 
-    int totalBorrowed = 0;
-    int totalReturned = 0;
-    int currentlyOwned = 0;
-
     cout << "\n---- Transaction History ----" << endl;
     cout << "--------------------------------------------------------------------------------" << endl;
     cout << "# | Game ID | Game Title                         | Borrowed   | Returned   | Status" << endl;
     cout << "--------------------------------------------------------------------------------" << endl;
 
     int rowNum = 1;
-    for (int i = 0; i < recordCount; i++) {
-        if (records[i].getMemberID() != memberID) continue;
-
-        totalBorrowed++;
-
-        int gIdx = gameHash.search(records[i].getGameID());
-        string title = (gIdx != -1) ? games[gIdx].getTitle() : "Unknown";
-        if (title.length() > 34) title = title.substr(0, 31) + "...";
+    IdHandle memberKey = members[memberIndex].getMemberKey();
+    for (int i = history.firstRecord(memberKey); i != -1; i = history.nextRecordOf(i)) {
+        int gIdx = catalog.findRow(records[i].getGameKey());
 
         cout << rowNum;
         if (rowNum < 10) cout << " ";
         cout << "| " << records[i].getGameID() << " | ";
 
-        cout << title;
-        for (int j = (int)title.length(); j < 34; j++) cout << " ";
+        printColumn((gIdx != -1) ? string_view(games[gIdx].getTitle()) : string_view("Unknown"), 34);
 
         cout << " | " << records[i].getBorrowDate() << " | ";
 
         if (records[i].getIsReturned()) {
-            totalReturned++;
             cout << records[i].getReturnDate() << " | Returned" << endl;
         }
         else {
-            currentlyOwned++;
             cout << "  --      | Borrowed" << endl;
         }
 
@@ -817,14 +870,15 @@ void displayMemberSummary(string memberID) {
 
     cout << "--------------------------------------------------------------------------------" << endl;
 
+    int totalBorrowed = history.timesBorrowed(memberKey);
     if (totalBorrowed == 0) {
         cout << "No transactions found for this member." << endl;
     }
     else {
         cout << "\nSummary:" << endl;
         cout << "  Total times borrowed : " << totalBorrowed << endl;
-        cout << "  Total times returned : " << totalReturned << endl;
-        cout << "  Currently borrowed   : " << currentlyOwned << endl;
+        cout << "  Total times returned : " << history.timesReturned(memberKey) << endl;
+        cout << "  Currently borrowed   : " << history.currentlyOut(memberKey) << endl;
     }
     cout << "======================================" << endl;
 }
@@ -836,11 +890,11 @@ void displayMemberSummary(string memberID) {
 Function    : memberBorrowGame
 Description : Asks the logged-in member for a game ID and
               delegates to borrowGame().
-Input       : string memberID - the currently logged-in member
+Input       : const string& memberID - the currently logged-in member
 Return      : None
 ============================================================
 */
-void memberBorrowGame(string memberID) {
+void memberBorrowGame(const string& memberID) {
     cout << "\n=== Borrow Game ===" << endl;
 
     string gameID;
@@ -857,11 +911,11 @@ Function    : memberReturnGame
 Description : Shows the member's currently borrowed games,
               asks for a game ID, verifies ownership, then
               delegates to returnGame().
-Input       : string memberID - the currently logged-in member
+Input       : const string& memberID - the currently logged-in member
 Return      : None
 ============================================================
 */
-void memberReturnGame(string memberID) {
+void memberReturnGame(const string& memberID) {
     cout << "\n=== Return Game ===" << endl;
 
     int memberIndex = findMember(memberID);
@@ -886,7 +940,7 @@ void memberReturnGame(string memberID) {
         return;
     }
 
-    if (games[gameIndex].getBorrowedBy() != memberID) {
+    if (games[gameIndex].getBorrowerKey() != memberIds.find(memberID)) {
         cout << "ERROR: You cannot return this game!" << endl;
         cout << "This game was borrowed by member " << games[gameIndex].getBorrowedBy() << endl;
         return;
@@ -900,11 +954,11 @@ void memberReturnGame(string memberID) {
 Function    : memberAddReview
 Description : Prompts the logged-in member for a game ID,
               rating and review text, then calls addReview().
-Input       : string memberID - the currently logged-in member
+Input       : const string& memberID - the currently logged-in member
 Return      : None
 ============================================================
 */
-void memberAddReview(string memberID) {
+void memberAddReview(const string& memberID) {
     cout << "\n=== Write a Review ===" << endl;
 
     string gameID;
@@ -931,8 +985,11 @@ void memberAddReview(string memberID) {
 ============================================================
 Function    : searchGamesByPlayers
 Description : Asks for a player count and a sort preference,
-              collects matching games, runs merge sort with
-              the chosen mode, then displays.
+              takes the matching games from the player-count
+              bucket and has the catalog put just those rows
+              into the order of the chosen view (see
+              GameCatalog::orderRows), so the cost follows the
+              number of matches rather than the catalog size.
 Input       : None (reads from cin)
 Return      : None
 ============================================================
@@ -945,8 +1002,8 @@ void searchGamesByPlayers() {
     cin >> numPlayers;
     clearInputBuffer();
 
-    Game results[MAX_GAMES];
-    int count = searchByPlayerCount(numPlayers, results, MAX_GAMES);
+    GameResultSet results(games);
+    int count = searchByPlayerCount(numPlayers, results);
 
     if (count == 0) {
         cout << "\nNo games found for " << numPlayers << " players." << endl;
@@ -975,8 +1032,9 @@ void searchGamesByPlayers() {
         break;
     }
 
-    mergeSort(results, 0, count - 1, mode);
-    displaySearchResults(results, count);
+    catalog.orderRows(mode, results.data(), results.size());
+
+    displaySearchResults(results);
 }
 
 /*
@@ -1017,6 +1075,348 @@ void displayGameWithReviews() {
     }
 }
 
+// ============= JOURNAL REPLAY =============
+
+/*
+============================================================
+Function    : replayJournalEntry
+Description : Re-applies one logged mutation at startup. IDs
+              are looked up again and the same checks as the
+              interactive path are made, so an entry that no
+              longer fits (for example a game dropped from
+              games.csv) is skipped instead of corrupting
+              state. Nothing is printed and nothing is logged
+              again.
+Input       : unsigned char type - JournalEntryType
+              JournalReader& fields - the entry's fields
+              void* context - unused
+Return      : None
+============================================================
+*/
+void replayJournalEntry(unsigned char type, JournalReader& fields, void* context) {
+    (void)context;
+    string memberID, gameID, date, text;
+    int rating;
+
+    switch (type) {
+    case JOURNAL_BORROW: {
+        if (!fields.getString(memberID) || !fields.getString(gameID) || !fields.getString(date)) return;
+        int memberIndex = findMember(memberID);
+        int gameIndex = gameHash.search(gameID);
+        if (memberIndex == -1 || gameIndex == -1) return;
+        if (games[gameIndex].getStatus() != "Available") return;
+        applyBorrow(memberIndex, gameIndex, date);
+        break;
+    }
+    case JOURNAL_RETURN: {
+        if (!fields.getString(gameID) || !fields.getString(date)) return;
+        int gameIndex = gameHash.search(gameID);
+        if (gameIndex == -1 || games[gameIndex].getStatus() == "Available") return;
+        int memberIndex = findMember(memberIds.name(games[gameIndex].getBorrowerKey()));
+        if (memberIndex == -1) return;
+        applyReturn(gameIndex, memberIndex, date);
+        break;
+    }
+    case JOURNAL_REVIEW: {
+        if (!fields.getString(memberID) || !fields.getString(gameID) || !fields.getInt(rating) ||
+            !fields.getString(text) || !fields.getString(date)) return;
+        int memberIndex = findMember(memberID);
+        int gameIndex = gameHash.search(gameID);
+        if (memberIndex == -1 || gameIndex == -1 || rating < 1 || rating > 10) return;
+        applyReview(memberIndex, gameIndex, rating, text, date);
+        break;
+    }
+    case JOURNAL_PLAY: {
+        int n;
+        string players[MAX_SESSION_PLAYERS], winner;
+        PlayRecord pr;
+        if (!fields.getString(gameID) || !fields.getInt(n)) return;
+        if (n < 1 || n > MAX_SESSION_PLAYERS) return;
+        for (int i = 0; i < n; i++) {
+            if (!fields.getString(players[i])) return;
+        }
+        if (!fields.getString(winner) || !fields.getString(memberID) ||
+            !fields.getString(pr.timestamp)) return;
+        if (!isValidPlaySession(gameID, players, n, winner) || !memberExistsByID(memberID)) return;
+
+        pr.gameKey = gameIds.find(gameID);
+        pr.numPlayers = n;
+        for (int i = 0; i < n; i++) pr.playerKeys[i] = memberIds.find(players[i]);
+        pr.winnerKey = memberIds.find(winner);
+        pr.recordedByKey = memberIds.find(memberID);
+        playRecords.add(pr);
+        break;
+    }
+    case JOURNAL_ADD_GAME: {
+        string title;
+        int minP, maxP, minT, maxT, year;
+        if (!fields.getString(gameID) || !fields.getString(title) || !fields.getInt(minP) ||
+            !fields.getInt(maxP) || !fields.getInt(minT) || !fields.getInt(maxT) ||
+            !fields.getInt(year)) return;
+        adminApplyAddGame(games, gameSlots, gameHash, catalog,
+            Game(gameID, title, minP, maxP, minT, maxT, year));
+        break;
+    }
+    case JOURNAL_REMOVE_GAME: {
+        if (!fields.getString(gameID)) return;
+        adminApplyRemoveGame(games, gameSlots, gameHash, catalog, gameID);
+        break;
+    }
+    case JOURNAL_UPDATE_GAME: {
+        string title;
+        int minP, maxP, minT, maxT, year;
+        if (!fields.getString(gameID) || !fields.getString(title) || !fields.getInt(minP) ||
+            !fields.getInt(maxP) || !fields.getInt(minT) || !fields.getInt(maxT) ||
+            !fields.getInt(year)) return;
+        adminApplyUpdateGame(games, gameHash, catalog, Game(gameID, title, minP, maxP, minT, maxT, year));
+        break;
+    }
+    case JOURNAL_ADD_MEMBER: {
+        string name, email;
+        if (!fields.getString(memberID) || !fields.getString(name) || !fields.getString(email)) return;
+        adminApplyAddMember(members, memberHash, Member(memberID, name, email));
+        break;
+    }
+    default:
+        break;   // written by a newer version: ignore
+    }
+}
+
+// ============= SNAPSHOT =============
+
+/*
+============================================================
+Function    : saveSnapshot
+Description : Writes the whole library state (games with their
+              status and borrow counts, members, borrow
+              records, reviews and play sessions) to
+              SNAPSHOT_FILE, tagged with the journal's epoch,
+              then compacts the journal since everything in
+              it is now part of the snapshot. Games are
+              stored slot by slot, an empty slot as an empty
+              ID, so slot positions survive a restart. Members'
+              borrowed lists are not stored separately: they
+              are exactly the open records, in record order.
+Input       : None
+Return      : bool - true if the snapshot was saved
+============================================================
+*/
+bool saveSnapshot() {
+    // Without a journal the snapshot could not be matched to it
+    if (!journal.isOpen()) return false;
+
+    SnapshotWriter writer;
+
+    writer.putInt(gameSlots.slotCount());
+    for (int i = 0; i < gameSlots.slotCount(); i++) {
+        if (!gameSlots.isLive(i)) {
+            writer.putString(string());
+            continue;
+        }
+        const Game& game = games[i];
+        writer.putString(game.getGameID());
+        writer.putString(game.getTitle());
+        writer.putInt(game.getMinPlayers());
+        writer.putInt(game.getMaxPlayers());
+        writer.putInt(game.getMinPlaytime());
+        writer.putInt(game.getMaxPlaytime());
+        writer.putInt(game.getYear());
+        writer.putString(game.getStatus());
+        writer.putString(game.getBorrowerKey() == NO_ID ? string() : game.getBorrowedBy());
+        writer.putInt(game.getBorrowCount());
+    }
+
+    writer.putInt(members.size());
+    for (int i = 0; i < members.size(); i++) {
+        writer.putString(members[i].getMemberID());
+        writer.putString(members[i].getName());
+        writer.putString(members[i].getEmail());
+    }
+
+    writer.putInt(records.size());
+    for (int i = 0; i < records.size(); i++) {
+        writer.putString(records[i].getGameID());
+        writer.putString(records[i].getMemberID());
+        writer.putString(records[i].getBorrowDate());
+        writer.putString(records[i].getReturnDate());
+        writer.putInt(records[i].getIsReturned() ? 1 : 0);
+    }
+
+    writer.putInt(reviews.size());
+    for (int i = 0; i < reviews.size(); i++) {
+        writer.putString(reviews[i].getGameID());
+        writer.putString(reviews[i].getMemberID());
+        writer.putString(reviews[i].getMemberName());
+        writer.putInt(reviews[i].getRating());
+        writer.putString(reviews[i].getReviewText());
+        writer.putString(reviews[i].getDate());
+    }
+
+    writer.putInt(playRecords.size());
+    for (int i = 0; i < playRecords.size(); i++) {
+        const PlayRecord& pr = playRecords[i];
+        writer.putString(gameIds.name(pr.gameKey));
+        writer.putInt(pr.numPlayers);
+        for (int j = 0; j < pr.numPlayers; j++) writer.putString(memberIds.name(pr.playerKeys[j]));
+        writer.putString(memberIds.name(pr.winnerKey));
+        writer.putString(memberIds.name(pr.recordedByKey));
+        writer.putString(pr.timestamp);
+    }
+
+    if (!writer.save(SNAPSHOT_FILE, journal.getEpoch())) return false;
+    journal.restart();
+    return true;
+}
+
+/*
+============================================================
+Function    : loadSnapshot
+Description : Rebuilds the library from a loaded snapshot
+              instead of games.csv, then builds every index
+              (hash tables, catalog, loans, member history,
+              reviews) from the restored arrays. Items are
+              appended as they are read, so a damaged count
+              fails at the end of the data rather than
+              allocating for it. On any malformed field the
+              arrays are emptied and both ID interners reset,
+              so the CSV the caller falls back to starts from
+              handle 0 with no IDs of the half-read snapshot.
+Input       : const Snapshot& snapshot - validated snapshot
+Return      : bool - true if the whole state was restored
+============================================================
+*/
+bool loadSnapshot(const Snapshot& snapshot) {
+    JournalReader fields = snapshot.fields();
+    string id, text, date, status, borrower;
+    int n;
+
+    bool ok = fields.getInt(n) && n >= 0;
+    for (int i = 0; ok && i < n; i++) {
+        string title;
+        int minP, maxP, minT, maxT, year, borrows;
+        ok = fields.getString(id);
+        if (ok && id.empty()) {
+            games.add(Game());   // empty slot
+            continue;
+        }
+        ok = ok && fields.getString(title) && fields.getInt(minP) &&
+            fields.getInt(maxP) && fields.getInt(minT) && fields.getInt(maxT) &&
+            fields.getInt(year) && fields.getString(status) && fields.getString(borrower) &&
+            fields.getInt(borrows);
+        if (!ok) break;
+        Game& game = games.add(Game(id, title, minP, maxP, minT, maxT, year));
+        game.setStatus(status);
+        game.setBorrowedBy(borrower.empty() ? NO_ID : memberIds.intern(borrower));
+        game.setBorrowCount(borrows);
+    }
+
+    ok = ok && fields.getInt(n) && n >= 0;
+    for (int i = 0; ok && i < n; i++) {
+        string name, email;
+        ok = fields.getString(id) && fields.getString(name) && fields.getString(email);
+        if (!ok) break;
+        memberHash.insert(id, members.size());
+        members.add(Member(id, name, email));
+    }
+
+    ok = ok && fields.getInt(n) && n >= 0;
+    for (int i = 0; ok && i < n; i++) {
+        string memberID, returnDate;
+        int returned;
+        ok = fields.getString(id) && fields.getString(memberID) && fields.getString(date) &&
+            fields.getString(returnDate) && fields.getInt(returned);
+        if (!ok) break;
+        BorrowRecord& record = records.add(BorrowRecord(gameIds.intern(id), memberIds.intern(memberID), date));
+        if (returned) {
+            record.setReturnDate(returnDate);
+            record.markAsReturned();
+        }
+    }
+
+    ok = ok && fields.getInt(n) && n >= 0;
+    for (int i = 0; ok && i < n; i++) {
+        string memberID, memberName;
+        int rating;
+        ok = fields.getString(id) && fields.getString(memberID) && fields.getString(memberName) &&
+            fields.getInt(rating) && fields.getString(text) && fields.getString(date);
+        if (!ok) break;
+        reviews.add(Review(gameIds.intern(id), memberIds.intern(memberID), memberName, rating, text, date));
+    }
+
+    ok = ok && fields.getInt(n) && n >= 0;
+    for (int i = 0; ok && i < n; i++) {
+        PlayRecord pr;
+        ok = fields.getString(id) && fields.getInt(pr.numPlayers) &&
+            pr.numPlayers >= 1 && pr.numPlayers <= MAX_SESSION_PLAYERS;
+        if (!ok) break;
+        pr.gameKey = gameIds.intern(id);
+        for (int j = 0; ok && j < pr.numPlayers; j++) {
+            ok = fields.getString(id);
+            pr.playerKeys[j] = memberIds.intern(id);
+        }
+        ok = ok && fields.getString(id);
+        pr.winnerKey = memberIds.intern(id);
+        ok = ok && fields.getString(id) && fields.getString(pr.timestamp);
+        pr.recordedByKey = memberIds.intern(id);
+        if (ok) playRecords.add(pr);
+    }
+
+    if (!ok) {
+        memberHash.clear();
+        gameSlots.reset(0);
+        games.clear();
+        members.clear();
+        records.clear();
+        reviews.clear();
+        playRecords.clear();
+        gameIds.clear();
+        memberIds.clear();
+        return false;
+    }
+
+    // Derived state, rebuilt exactly as the live updates would leave it
+    int slots = games.size();
+    gameSlots.reset(slots);
+    for (int i = 0; i < slots; i++) {
+        if (games[i].getGameKey() == NO_ID) gameSlots.release(i);
+        else gameHash.insert(games[i].getGameID(), i);
+    }
+    catalog.rebuild(games, slots);
+
+    for (int i = 0; i < records.size(); i++) {
+        IdHandle memberKey = records[i].getMemberKey();
+        history.addRecord(i, memberKey);
+        if (records[i].getIsReturned()) {
+            history.markReturned(memberKey);
+            continue;
+        }
+        loans.open(records[i].getGameKey(), i);
+        int memberIndex = findMember(records[i].getMemberID());
+        if (memberIndex != -1) members[memberIndex].addBorrowedGame(records[i].getGameKey());
+    }
+
+    for (int i = 0; i < reviews.size(); i++) {
+        reviewIndex.addReview(i, reviews[i].getGameKey(), reviews[i].getRating());
+    }
+    return true;
+}
+
+/*
+============================================================
+Function    : snapshotIfDue
+Description : Takes an automatic snapshot once the journal
+              holds SNAPSHOT_INTERVAL_CHANGES records, keeping
+              both the replay at startup and the log short.
+Input       : None
+Return      : None
+============================================================
+*/
+void snapshotIfDue() {
+    if (journal.size() >= SNAPSHOT_INTERVAL_CHANGES) {
+        saveSnapshot();
+    }
+}
+
 // ============= MENU FUNCTIONS =============
 
 /*
@@ -1040,7 +1440,13 @@ void adminMenu() {
         cout << "3. Add New Member" << endl;
         cout << "4. Display Summary of Games Borrowed/Returned" << endl;
         cout << "5. View All Games by Borrow Count" << endl;
-        cout << "6. Back to Main Menu" << endl;
+        cout << "6. Run Sort Benchmark" << endl;
+        cout << "7. Run CSV Tokenizer Benchmark" << endl;
+        cout << "8. Run Borrowed-Games Churn Benchmark" << endl;
+        cout << "9. Run Read-Path Allocation Check" << endl;
+        cout << "10. Reload Games from CSV" << endl;
+        cout << "11. Save Snapshot Now" << endl;
+        cout << "12. Back to Main Menu" << endl;
         cout << "======================================" << endl;
         cout << "Enter choice: ";
 
@@ -1054,26 +1460,59 @@ void adminMenu() {
 
         switch (choice) {
         case 1:
-            adminAddGame(games, gameCount, MAX_GAMES, gameHash);
+            adminAddGame(games, gameSlots, gameHash, catalog, journal);
             pauseScreen();
             break;
         case 2:
-            adminRemoveGame(games, gameCount, gameHash);
+            adminRemoveGame(games, gameSlots, gameHash, catalog, journal);
             pauseScreen();
             break;
         case 3:
-            adminAddMember(members, memberCount, MAX_MEMBERS);
+            adminAddMember(members, memberHash, journal);
             pauseScreen();
             break;
         case 4:
-            adminDisplaySummary(games, gameCount);
+            adminDisplaySummary(games, gameSlots, catalog, loans);
             pauseScreen();
             break;
         case 5:
-            adminDisplayAllGamesSorted(games, gameCount);
+            adminDisplayAllGamesSorted(games, gameSlots.size(), catalog);
             pauseScreen();
             break;
         case 6:
+            runSortBenchmark(games, gameSlots);
+            pauseScreen();
+            break;
+        case 7:
+            runCsvBenchmark(games, gameSlots);
+            pauseScreen();
+            break;
+        case 8:
+            runBorrowChurnBenchmark();
+            pauseScreen();
+            break;
+        case 9:
+            runReadPathAllocationCheck(games, gameSlots, gameHash, catalog);
+            pauseScreen();
+            break;
+        case 10:
+            // The CSV numbers its rows by position, so after a reload
+            // it is no longer a base the journal can be replayed on
+            if (adminReloadGames(GAMES_FILE, games, gameSlots, gameHash, catalog, journal)) {
+                saveSnapshot();
+            }
+            pauseScreen();
+            break;
+        case 11:
+            if (saveSnapshot()) {
+                cout << "SUCCESS: Snapshot saved to " << SNAPSHOT_FILE << "; journal compacted." << endl;
+            }
+            else {
+                cout << "ERROR: Could not save the snapshot." << endl;
+            }
+            pauseScreen();
+            break;
+        case 12:
             cout << "Returning to main menu..." << endl;
             break;
         default:
@@ -1081,8 +1520,9 @@ void adminMenu() {
             pauseScreen();
             break;
         }
+        snapshotIfDue();
 
-    } while (choice != 6);
+    } while (choice != 12);
 }
 
 /*
@@ -1171,6 +1611,7 @@ void memberMenu() {
         default:
             cout << "Invalid choice! Please try again." << endl;
         }
+        snapshotIfDue();
     } while (choice != 8);
 }
 
@@ -1265,36 +1706,65 @@ void mainMenu() {
 /*
 ============================================================
 Function    : main
-Description : Entry point. Loads games from CSV, builds the
-              hash table, initializes test members, then
-              launches the main menu loop.
+Description : Entry point. Restores the library from the
+              binary snapshot when there is one; otherwise
+              loads games from CSV, builds the hash table and
+              columnar catalog and initializes and indexes
+              test members. Then replays the journal and
+              launches the main menu loop. A snapshot is
+              saved on exit so the next start skips the CSV.
 Input       : None
 Return      : int - 0 on success, 1 if CSV fails to load
 ============================================================
 */
 int main() {
-    cout << "Loading games from database..." << endl;
-    gameCount = loadGamesFromCSV("games.csv", games, MAX_GAMES);
-    //if program does not load 629 games, use full path like the example below
-    //gameCount = loadGamesFromCSV("C:\\Users\\milok\\Downloads\\games.csv", games, MAX_GAMES);
+    Snapshot snapshot;
+    bool fromSnapshot = snapshot.load(SNAPSHOT_FILE) && loadSnapshot(snapshot);
 
-    if (gameCount == 0) {
-        cout << "Failed to load games. Exiting." << endl;
-        return 1;
+    if (fromSnapshot) {
+        cout << "Loaded " << gameSlots.size() << " games and " << members.size()
+            << " members from " << SNAPSHOT_FILE << endl;
     }
+    else {
+        cout << "Loading games from database..." << endl;
+        int gameCount = loadGamesFromCSV(GAMES_FILE, games, nullptr, &sharedTaskPool());
+        //if program does not load 629 games, use full path like the example below
+        //gameCount = loadGamesFromCSV("C:\\Users\\milok\\Downloads\\games.csv", games);
+
+        if (gameCount == 0) {
+            cout << "Failed to load games. Exiting." << endl;
+            return 1;
+        }
 
-    buildHashTable(games, gameCount, gameHash);
+        gameSlots.reset(gameCount);
+        buildHashTable(games, gameCount, gameHash, &sharedTaskPool());
+        catalog.rebuild(games, gameCount);
 
-    members[0] = Member("M001", "Alice Tan", "alice@email.com");
-    members[1] = Member("M002", "Bob Lee", "bob@email.com");
-    members[2] = Member("M003", "Charlie Wong", "charlie@email.com");
-    memberCount = 3;
+        members.add(Member("M001", "Alice Tan", "alice@email.com"));
+        members.add(Member("M002", "Bob Lee", "bob@email.com"));
+        members.add(Member("M003", "Charlie Wong", "charlie@email.com"));
+        for (int i = 0; i < members.size(); i++) {
+            memberHash.insert(members[i].getMemberID(), i);
+        }
+    }
+
+    // Bring back everything that happened since the snapshot
+    uint32_t coveredEpoch = fromSnapshot ? snapshot.getEpoch() : 0;
+    int replayed = journal.open(JOURNAL_FILE, JOURNAL_SYNC_INTERVAL_MS, coveredEpoch,
+        replayJournalEntry, nullptr);
+    if (replayed > 0) {
+        cout << "Restored " << replayed << " saved change(s) from " << JOURNAL_FILE << endl;
+    }
 
     cout << "\nSystem initialized successfully!" << endl;
-    cout << "Test members created: M001, M002, M003" << endl;
+    if (!fromSnapshot) cout << "Test members created: M001, M002, M003" << endl;
     cout << "Today's date: " << getCurrentDate() << endl;
 
     mainMenu();
 
+    if (!fromSnapshot || journal.size() > 0) {
+        saveSnapshot();
+    }
+    journal.close();
     return 0;
 }
\ No newline at end of file
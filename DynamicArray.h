@@ -0,0 +1,314 @@
+#pragma once
+#include <cstring>
+
+/*
+============================================================
+Class       : DynamicArray
+Description : Growable contiguous array for plain values
+              (ints, handles, small structs without owned
+              memory). Doubles its capacity when full, so
+              append is amortised O(1). Elements are moved
+              with memcpy/memmove, which is why T must be
+              trivially copyable. Used for index posting lists
+              and result sets. Templates must be defined in
+              the header, so the member functions live below
+              the class.
+============================================================
+*/
+template <class T>
+class DynamicArray {
+private:
+    T* items;
+    int count;
+    int capacity;
+
+    void reserveFor(int needed);
+
+public:
+    DynamicArray();
+    DynamicArray(const DynamicArray& other);
+    DynamicArray& operator=(const DynamicArray& other);
+    ~DynamicArray();
+
+    void add(const T& item);
+    void insertAt(int index, const T& item);
+    void removeAt(int index);
+    void clear();
+    void reserve(int newCapacity);
+    void resize(int newCount);
+    void swap(DynamicArray& other);
+
+    int size() const;
+    bool isEmpty() const;
+    T* data();
+    const T* data() const;
+    T& operator[](int index);
+    const T& operator[](int index) const;
+};
+
+/*
+============================================================
+Function    : DynamicArray (Constructor)
+Description : Creates an empty array; nothing is allocated
+              until the first add.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T>
+DynamicArray<T>::DynamicArray() {
+    items = nullptr;
+    count = 0;
+    capacity = 0;
+}
+
+/*
+============================================================
+Function    : DynamicArray (Copy Constructor)
+Description : Creates an independent copy of another array.
+Input       : other - Array to copy (const DynamicArray&)
+Return      : None
+============================================================
+*/
+template <class T>
+DynamicArray<T>::DynamicArray(const DynamicArray& other) {
+    items = nullptr;
+    count = 0;
+    capacity = 0;
+    *this = other;
+}
+
+/*
+============================================================
+Function    : operator=
+Description : Replaces the contents with a copy of another
+              array.
+Input       : other - Array to copy (const DynamicArray&)
+Return      : This array (DynamicArray&)
+============================================================
+*/
+template <class T>
+DynamicArray<T>& DynamicArray<T>::operator=(const DynamicArray& other) {
+    if (this == &other) return *this;
+    count = 0;
+    reserveFor(other.count);
+    if (other.count > 0) {
+        memcpy(items, other.items, other.count * sizeof(T));
+    }
+    count = other.count;
+    return *this;
+}
+
+/*
+============================================================
+Function    : ~DynamicArray (Destructor)
+Description : Releases the element buffer.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T>
+DynamicArray<T>::~DynamicArray() {
+    delete[] items;
+}
+
+/*
+============================================================
+Function    : reserveFor
+Description : Makes sure there is room for 'needed' elements,
+              doubling the capacity as often as required.
+Input       : needed - Required capacity (int)
+Return      : None
+============================================================
+*/
+template <class T>
+void DynamicArray<T>::reserveFor(int needed) {
+    if (needed <= capacity) return;
+    int newCapacity = (capacity == 0) ? 4 : capacity;
+    while (newCapacity < needed) newCapacity *= 2;
+    reserve(newCapacity);
+}
+
+/*
+============================================================
+Function    : reserve
+Description : Grows the buffer to exactly newCapacity
+              elements (never shrinks).
+Input       : newCapacity - Capacity to allocate (int)
+Return      : None
+============================================================
+*/
+template <class T>
+void DynamicArray<T>::reserve(int newCapacity) {
+    if (newCapacity <= capacity) return;
+    T* newItems = new T[newCapacity];
+    if (count > 0) {
+        memcpy(newItems, items, count * sizeof(T));
+    }
+    delete[] items;
+    items = newItems;
+    capacity = newCapacity;
+}
+
+/*
+============================================================
+Function    : resize
+Description : Sets the number of elements. New elements are
+              left uninitialised; callers fill them.
+Input       : newCount - New element count (int)
+Return      : None
+============================================================
+*/
+template <class T>
+void DynamicArray<T>::resize(int newCount) {
+    reserveFor(newCount);
+    count = newCount;
+}
+
+/*
+============================================================
+Function    : swap
+Description : Exchanges contents with another array in O(1)
+              (just the buffers change hands).
+Input       : other - Array to swap with (DynamicArray&)
+Return      : None
+============================================================
+*/
+template <class T>
+void DynamicArray<T>::swap(DynamicArray& other) {
+    T* items0 = items;
+    int count0 = count;
+    int capacity0 = capacity;
+    items = other.items;
+    count = other.count;
+    capacity = other.capacity;
+    other.items = items0;
+    other.count = count0;
+    other.capacity = capacity0;
+}
+
+/*
+============================================================
+Function    : add
+Description : Appends an element to the back of the array.
+Input       : item - Element to append (const T&)
+Return      : None
+============================================================
+*/
+template <class T>
+void DynamicArray<T>::add(const T& item) {
+    reserveFor(count + 1);
+    items[count] = item;
+    count++;
+}
+
+/*
+============================================================
+Function    : insertAt
+Description : Inserts an element at 'index', shifting later
+              elements up by one.
+Input       : index - Position to insert at, 0..size() (int)
+              item - Element to insert (const T&)
+Return      : None
+============================================================
+*/
+template <class T>
+void DynamicArray<T>::insertAt(int index, const T& item) {
+    if (index < 0 || index > count) return;
+    reserveFor(count + 1);
+    memmove(items + index + 1, items + index, (count - index) * sizeof(T));
+    items[index] = item;
+    count++;
+}
+
+/*
+============================================================
+Function    : removeAt
+Description : Removes the element at 'index', shifting later
+              elements down by one.
+Input       : index - Position to remove (int)
+Return      : None
+============================================================
+*/
+template <class T>
+void DynamicArray<T>::removeAt(int index) {
+    if (index < 0 || index >= count) return;
+    memmove(items + index, items + index + 1, (count - index - 1) * sizeof(T));
+    count--;
+}
+
+/*
+============================================================
+Function    : clear
+Description : Removes every element but keeps the buffer for
+              reuse.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T>
+void DynamicArray<T>::clear() {
+    count = 0;
+}
+
+/*
+============================================================
+Function    : size
+Description : Returns the number of elements.
+Input       : None
+Return      : Element count (int)
+============================================================
+*/
+template <class T>
+int DynamicArray<T>::size() const {
+    return count;
+}
+
+/*
+============================================================
+Function    : isEmpty
+Description : Checks if the array has no elements.
+Input       : None
+Return      : True if empty, false otherwise (bool)
+============================================================
+*/
+template <class T>
+bool DynamicArray<T>::isEmpty() const {
+    return count == 0;
+}
+
+/*
+============================================================
+Function    : data
+Description : Gives direct access to the contiguous elements.
+Input       : None
+Return      : Pointer to the first element (T*)
+============================================================
+*/
+template <class T>
+T* DynamicArray<T>::data() {
+    return items;
+}
+
+template <class T>
+const T* DynamicArray<T>::data() const {
+    return items;
+}
+
+/*
+============================================================
+Function    : operator[]
+Description : Accesses the element at 'index' (unchecked).
+Input       : index - Element position (int)
+Return      : Reference to the element (T&)
+============================================================
+*/
+template <class T>
+T& DynamicArray<T>::operator[](int index) {
+    return items[index];
+}
+
+template <class T>
+const T& DynamicArray<T>::operator[](int index) const {
+    return items[index];
+}
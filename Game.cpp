@@ -13,7 +13,7 @@ Return      : None
 ============================================================
 */
 Game::Game() {
-    gameID = "";
+    gameKey = NO_ID;
     title = "";
     minPlayers = 0;
     maxPlayers = 0;
@@ -21,7 +21,7 @@ Game::Game() {
     maxPlaytime = 0;
     yearPublished = 0;
     status = "Available";
-    borrowedBy = "";
+    borrowedBy = NO_ID;
     borrowCount = 0;
 }
 
@@ -30,6 +30,7 @@ Game::Game() {
 Function    : Game (Parameterized Constructor)
 Description : Initializes a Game object with the provided
               game details and sets status to "Available".
+              The game ID is interned into a dense handle.
 Input       : id - Game ID (string)
               name - Game title (string)
               minP - Minimum players (int)
@@ -41,7 +42,7 @@ Return      : None
 ============================================================
 */
 Game::Game(string id, string name, int minP, int maxP, int minTime, int maxTime, int year) {
-    gameID = id;
+    gameKey = gameIds.intern(id);
     title = name;
     minPlayers = minP;
     maxPlayers = maxP;
@@ -49,7 +50,7 @@ Game::Game(string id, string name, int minP, int maxP, int minTime, int maxTime,
     maxPlaytime = maxTime;
     yearPublished = year;
     status = "Available";
-    borrowedBy = "";
+    borrowedBy = NO_ID;
     borrowCount = 0;
 }
 
@@ -60,20 +61,30 @@ Game::Game(string id, string name, int minP, int maxP, int minTime, int maxTime,
 Function    : getGameID
 Description : Returns the game ID.
 Input       : None
-Return      : Game ID (string)
+Return      : Game ID (const string&)
 ============================================================
 */
-string Game::getGameID() { return gameID; }
+const string& Game::getGameID() const { return gameIds.name(gameKey); }
+
+/*
+============================================================
+Function    : getGameKey
+Description : Returns the interned handle of the game ID.
+Input       : None
+Return      : Game handle (IdHandle)
+============================================================
+*/
+IdHandle Game::getGameKey() const { return gameKey; }
 
 /*
 ============================================================
 Function    : getTitle
 Description : Returns the game title.
 Input       : None
-Return      : Game title (string)
+Return      : Game title (const string&)
 ============================================================
 */
-string Game::getTitle() { return title; }
+const string& Game::getTitle() const { return title; }
 
 /*
 ============================================================
@@ -83,7 +94,7 @@ Input       : None
 Return      : Minimum players (int)
 ============================================================
 */
-int Game::getMinPlayers() { return minPlayers; }
+int Game::getMinPlayers() const { return minPlayers; }
 
 /*
 ============================================================
@@ -93,7 +104,7 @@ Input       : None
 Return      : Maximum players (int)
 ============================================================
 */
-int Game::getMaxPlayers() { return maxPlayers; }
+int Game::getMaxPlayers() const { return maxPlayers; }
 
 /*
 ============================================================
@@ -103,7 +114,7 @@ Input       : None
 Return      : Minimum playtime (int)
 ============================================================
 */
-int Game::getMinPlaytime() { return minPlaytime; }
+int Game::getMinPlaytime() const { return minPlaytime; }
 
 /*
 ============================================================
@@ -113,7 +124,7 @@ Input       : None
 Return      : Maximum playtime (int)
 ============================================================
 */
-int Game::getMaxPlaytime() { return maxPlaytime; }
+int Game::getMaxPlaytime() const { return maxPlaytime; }
 
 /*
 ============================================================
@@ -123,27 +134,37 @@ Input       : None
 Return      : Year published (int)
 ============================================================
 */
-int Game::getYear() { return yearPublished; }
+int Game::getYear() const { return yearPublished; }
 
 /*
 ============================================================
 Function    : getStatus
 Description : Returns the current status of the game.
 Input       : None
-Return      : Status - "Available" or "Borrowed" (string)
+Return      : Status - "Available" or "Borrowed" (const string&)
 ============================================================
 */
-string Game::getStatus() { return status; }
+const string& Game::getStatus() const { return status; }
 
 /*
 ============================================================
 Function    : getBorrowedBy
 Description : Returns the member ID of who borrowed the game.
 Input       : None
-Return      : Member ID (string, empty if available)
+Return      : Member ID (const string&, empty if available)
+============================================================
+*/
+const string& Game::getBorrowedBy() const { return memberIds.name(borrowedBy); }
+
+/*
+============================================================
+Function    : getBorrowerKey
+Description : Returns the interned handle of the borrower.
+Input       : None
+Return      : Member handle (IdHandle, NO_ID if available)
 ============================================================
 */
-string Game::getBorrowedBy() { return borrowedBy; }
+IdHandle Game::getBorrowerKey() const { return borrowedBy; }
 
 /*
 ============================================================
@@ -154,7 +175,7 @@ Input       : None
 Return      : Borrow count (int)
 ============================================================
 */
-int Game::getBorrowCount() { return borrowCount; }
+int Game::getBorrowCount() const { return borrowCount; }
 
 // Setters
 
@@ -166,17 +187,18 @@ Input       : s - New status (string)
 Return      : None
 ============================================================
 */
-void Game::setStatus(string s) { status = s; }
+void Game::setStatus(const string& s) { status = s; }
 
 /*
 ============================================================
 Function    : setBorrowedBy
-Description : Sets the member ID of who is borrowing the game.
-Input       : memberID - Member ID (string)
+Description : Sets the member who is borrowing the game.
+Input       : memberKey - Member handle (IdHandle, NO_ID to
+              clear)
 Return      : None
 ============================================================
 */
-void Game::setBorrowedBy(string memberID) { borrowedBy = memberID; }
+void Game::setBorrowedBy(IdHandle memberKey) { borrowedBy = memberKey; }
 
 /*
 ============================================================
@@ -188,6 +210,16 @@ Return      : None
 */
 void Game::incrementBorrowCount() { borrowCount++; }
 
+/*
+============================================================
+Function    : setBorrowCount
+Description : Restores a saved borrow count (snapshot load).
+Input       : count - Times borrowed so far (int)
+Return      : None
+============================================================
+*/
+void Game::setBorrowCount(int count) { borrowCount = count; }
+
 /*
 ============================================================
 Function    : display
@@ -199,14 +231,14 @@ Return      : None
 */
 void Game::display() {
     cout << "==================================" << endl;
-    cout << "Game ID: " << gameID << endl;
+    cout << "Game ID: " << getGameID() << endl;
     cout << "Title: " << title << endl;
     cout << "Year: " << yearPublished << endl;
     cout << "Players: " << minPlayers << "-" << maxPlayers << endl;
     cout << "Playtime: " << minPlaytime << "-" << maxPlaytime << " mins" << endl;
     cout << "Status: " << status << endl;
     if (status == "Borrowed") {
-        cout << "Borrowed by: " << borrowedBy << endl;
+        cout << "Borrowed by: " << getBorrowedBy() << endl;
     }
     cout << "Times borrowed: " << borrowCount << endl;
     cout << "==================================" << endl;
@@ -222,6 +254,6 @@ Return      : Formatted string (string)
 ============================================================
 */
 string Game::toString() {
-    return gameID + "|" + title + "|" + to_string(yearPublished) +
+    return getGameID() + "|" + title + "|" + to_string(yearPublished) +
         "|" + to_string(minPlayers) + "-" + to_string(maxPlayers);
 }
\ No newline at end of file
@@ -1,10 +1,11 @@
 #pragma once
 #include <string>
+#include "IdInterner.h"
 using namespace std;
 
 class Game {
 private:
-    string gameID;      // auto-generated
+    IdHandle gameKey;   // interned game ID (auto-generated)
     string title;
     int minPlayers;
     int maxPlayers;
@@ -12,7 +13,7 @@ private:
     int maxPlaytime;
     int yearPublished;
     string status;      // "Available" or "Borrowed"
-    string borrowedBy;  // Member ID if borrowed
+    IdHandle borrowedBy;  // Interned member ID if borrowed, NO_ID otherwise
     int borrowCount;    // For statistics
 
 public:
@@ -21,21 +22,24 @@ public:
     Game(string id, string name, int minP, int maxP, int minTime, int maxTime, int year);
 
     // Getters
-    string getGameID();
-    string getTitle();
-    int getMinPlayers();
-    int getMaxPlayers();
-    int getMinPlaytime();
-    int getMaxPlaytime();
-    int getYear();
-    string getStatus();
-    string getBorrowedBy();
-    int getBorrowCount();
+    const string& getGameID() const;
+    IdHandle getGameKey() const;
+    const string& getTitle() const;
+    int getMinPlayers() const;
+    int getMaxPlayers() const;
+    int getMinPlaytime() const;
+    int getMaxPlaytime() const;
+    int getYear() const;
+    const string& getStatus() const;
+    const string& getBorrowedBy() const;
+    IdHandle getBorrowerKey() const;
+    int getBorrowCount() const;
 
     // Setters
-    void setStatus(string s);
-    void setBorrowedBy(string memberID);
+    void setStatus(const string& s);
+    void setBorrowedBy(IdHandle memberKey);
     void incrementBorrowCount();
+    void setBorrowCount(int count);
 
     // Display
     void display();
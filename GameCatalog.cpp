@@ -0,0 +1,789 @@
+#include "GameCatalog.h"
+#include <cstring>
+#include <climits>
+
+// AVX2 is used when the compiler targets it (/arch:AVX2 or -mavx2);
+// otherwise SSE2, which every x64 compiler enables by default.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CATALOG_USE_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CATALOG_USE_SSE2
+#endif
+
+using namespace std;
+
+/*
+============================================================
+Function    : GameCatalog (Constructor)
+Description : Creates an empty catalog with room for
+              CATALOG_INITIAL_CAPACITY rows.
+Input       : None
+Return      : None
+============================================================
+*/
+GameCatalog::GameCatalog() {
+    minPlayers = nullptr;
+    maxPlayers = nullptr;
+    minPlaytime = nullptr;
+    maxPlaytime = nullptr;
+    year = nullptr;
+    status = nullptr;
+    borrowCount = nullptr;
+    titleKey = nullptr;
+    gameKey = nullptr;
+    source = nullptr;
+    count = 0;
+    capacity = 0;
+    allocateColumns(CATALOG_INITIAL_CAPACITY);
+}
+
+/*
+============================================================
+Function    : ~GameCatalog (Destructor)
+Description : Releases every column array.
+Input       : None
+Return      : None
+============================================================
+*/
+GameCatalog::~GameCatalog() {
+    delete[] minPlayers;
+    delete[] maxPlayers;
+    delete[] minPlaytime;
+    delete[] maxPlaytime;
+    delete[] year;
+    delete[] status;
+    delete[] borrowCount;
+    delete[] titleKey;
+    delete[] gameKey;
+}
+
+/*
+============================================================
+Function    : allocateColumns
+Description : Reallocates every column to a new capacity and
+              copies the existing rows across.
+Input       : newCapacity - Number of rows to hold (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::allocateColumns(int newCapacity) {
+    int* newMinPlayers = new int[newCapacity];
+    int* newMaxPlayers = new int[newCapacity];
+    int* newMinPlaytime = new int[newCapacity];
+    int* newMaxPlaytime = new int[newCapacity];
+    int* newYear = new int[newCapacity];
+    unsigned char* newStatus = new unsigned char[newCapacity];
+    int* newBorrowCount = new int[newCapacity];
+    uint64_t* newTitleKey = new uint64_t[newCapacity];
+    IdHandle* newGameKey = new IdHandle[newCapacity];
+
+    if (count > 0) {
+        memcpy(newMinPlayers, minPlayers, count * sizeof(int));
+        memcpy(newMaxPlayers, maxPlayers, count * sizeof(int));
+        memcpy(newMinPlaytime, minPlaytime, count * sizeof(int));
+        memcpy(newMaxPlaytime, maxPlaytime, count * sizeof(int));
+        memcpy(newYear, year, count * sizeof(int));
+        memcpy(newStatus, status, count * sizeof(unsigned char));
+        memcpy(newBorrowCount, borrowCount, count * sizeof(int));
+        memcpy(newTitleKey, titleKey, count * sizeof(uint64_t));
+        memcpy(newGameKey, gameKey, count * sizeof(IdHandle));
+    }
+
+    delete[] minPlayers;
+    delete[] maxPlayers;
+    delete[] minPlaytime;
+    delete[] maxPlaytime;
+    delete[] year;
+    delete[] status;
+    delete[] borrowCount;
+    delete[] titleKey;
+    delete[] gameKey;
+
+    minPlayers = newMinPlayers;
+    maxPlayers = newMaxPlayers;
+    minPlaytime = newMinPlaytime;
+    maxPlaytime = newMaxPlaytime;
+    year = newYear;
+    status = newStatus;
+    borrowCount = newBorrowCount;
+    titleKey = newTitleKey;
+    gameKey = newGameKey;
+    capacity = newCapacity;
+}
+
+/*
+============================================================
+Function    : writeRow
+Description : Copies the numeric fields of a game into row
+              'index' of every column.
+Input       : index - Row to write (int)
+              game - Source game (const Game&)
+Return      : None
+============================================================
+*/
+void GameCatalog::writeRow(int index, const Game& game) {
+    minPlayers[index] = game.getMinPlayers();
+    maxPlayers[index] = game.getMaxPlayers();
+    minPlaytime[index] = game.getMinPlaytime();
+    maxPlaytime[index] = game.getMaxPlaytime();
+    year[index] = game.getYear();
+    status[index] = (game.getStatus() == "Borrowed") ? STATUS_BORROWED : STATUS_AVAILABLE;
+    borrowCount[index] = game.getBorrowCount();
+    titleKey[index] = titleCollationKey(game.getTitle());
+    gameKey[index] = game.getGameKey();
+}
+
+/*
+============================================================
+Function    : clearRow
+Description : Marks a row as an empty slot: an empty player
+              range (so no filter or bucket matches it) and no
+              game handle.
+Input       : index - Row to clear (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::clearRow(int index) {
+    minPlayers[index] = INT_MAX;
+    maxPlayers[index] = INT_MIN;
+    minPlaytime[index] = 0;
+    maxPlaytime[index] = 0;
+    year[index] = 0;
+    status[index] = STATUS_AVAILABLE;
+    borrowCount[index] = 0;
+    titleKey[index] = 0;
+    gameKey[index] = NO_ID;
+}
+
+/*
+============================================================
+Function    : setRowOfKey
+Description : Records which row holds a game handle, growing
+              the handle table as new handles appear.
+Input       : key - Game handle (IdHandle)
+              row - Its row, or -1 to forget it (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::setRowOfKey(IdHandle key, int row) {
+    if (key == NO_ID) return;
+    if (key >= (IdHandle)rowByKey.size()) {
+        if (row == -1) return;
+        int oldSize = rowByKey.size();
+        rowByKey.resize((int)key + 1);
+        for (int i = oldSize; i < rowByKey.size(); i++) {
+            rowByKey[i] = -1;
+        }
+    }
+    rowByKey[key] = row;
+}
+
+/*
+============================================================
+Function    : compareTitles
+Description : Compares the titles of two rows: the collation
+              keys first, the full titles in games[] only when
+              the keys are equal.
+Input       : a - First row (int)
+              b - Second row (int)
+Return      : <0, 0 or >0 like string::compare (int)
+============================================================
+*/
+int GameCatalog::compareTitles(int a, int b) const {
+    if (titleKey[a] != titleKey[b]) return (titleKey[a] < titleKey[b]) ? -1 : 1;
+    return (*source)[a].getTitle().compare((*source)[b].getTitle());
+}
+
+/*
+============================================================
+Function    : rowBefore
+Description : Strict order of a view: the view's key, then the
+              row number, so every row has exactly one place.
+              SORT_BY_BORROWS_DESC (used by orderRows) is the
+              most-borrowed ranking: count descending, then row.
+Input       : mode - Order (SortMode)
+              a - First row (int)
+              b - Second row (int)
+Return      : True if row a comes before row b (bool)
+============================================================
+*/
+bool GameCatalog::rowBefore(SortMode mode, int a, int b) const {
+    if (mode == SORT_BY_YEAR || mode == SORT_BY_TITLE) {
+        if (mode == SORT_BY_YEAR && year[a] != year[b]) return year[a] < year[b];
+        int order = compareTitles(a, b);
+        if (order != 0) return order < 0;
+    }
+    else if (borrowCount[a] != borrowCount[b]) {
+        if (mode == SORT_BY_BORROWS_DESC) return borrowCount[a] > borrowCount[b];
+        return borrowCount[a] < borrowCount[b];
+    }
+    return a < b;
+}
+
+/*
+============================================================
+Function    : insertPoint
+Description : Binary search for the first slot in
+              view[low..high) whose row does not come before
+              'row'.
+Input       : view - View to search (const DynamicArray<int>&)
+              mode - View order (SortMode)
+              row - Row being placed (int)
+              low, high - Slot range to search (int)
+Return      : Slot position (int)
+============================================================
+*/
+int GameCatalog::insertPoint(const DynamicArray<int>& view, SortMode mode, int row, int low, int high) const {
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (rowBefore(mode, view[mid], row)) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+/*
+============================================================
+Function    : viewInsert
+Description : Inserts a row at its place in a view.
+Input       : view - View to update (DynamicArray<int>&)
+              mode - View order (SortMode)
+              row - Row to insert (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::viewInsert(DynamicArray<int>& view, SortMode mode, int row) {
+    view.insertAt(insertPoint(view, mode, row, 0, view.size()), row);
+}
+
+/*
+============================================================
+Function    : viewRepair
+Description : Moves a row whose key has just changed from
+              oldSlot to its new place. Only the part of the
+              view on the side the row moves towards is
+              searched, and only the rows in between shift.
+Input       : view - View to repair (DynamicArray<int>&)
+              mode - View order (SortMode)
+              row - Row whose key changed (int)
+              oldSlot - Where the row sat before (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::viewRepair(DynamicArray<int>& view, SortMode mode, int row, int oldSlot) {
+    int* slots = view.data();
+    if (oldSlot + 1 < view.size() && rowBefore(mode, slots[oldSlot + 1], row)) {
+        // Moves right: lands just before the first row not before it
+        int target = insertPoint(view, mode, row, oldSlot + 1, view.size()) - 1;
+        memmove(slots + oldSlot, slots + oldSlot + 1, (target - oldSlot) * sizeof(int));
+        slots[target] = row;
+    }
+    else if (oldSlot > 0 && rowBefore(mode, row, slots[oldSlot - 1])) {
+        // Moves left
+        int target = insertPoint(view, mode, row, 0, oldSlot);
+        memmove(slots + target + 1, slots + target, (oldSlot - target) * sizeof(int));
+        slots[target] = row;
+    }
+}
+
+/*
+============================================================
+Function    : viewErase
+Description : Drops a row from a view. Its slot is found by
+              binary search, so the row's keys (and its title
+              in games[]) must still be in place.
+Input       : view - View to update (DynamicArray<int>&)
+              mode - View order (SortMode)
+              row - Row to drop (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::viewErase(DynamicArray<int>& view, SortMode mode, int row) {
+    int slot = insertPoint(view, mode, row, 0, view.size());
+    if (slot < view.size() && view[slot] == row) {
+        view.removeAt(slot);
+    }
+}
+
+/*
+============================================================
+Function    : rebuild
+Description : Replaces the catalog, its player index and its
+              ordered views with the contents of
+              games[0..slotCount-1]. Empty slots (a default
+              Game, with no ID) become cleared rows that no
+              view or bucket lists. The views are produced by
+              one stable sort each. Called after a bulk load.
+Input       : games[] - Array of Game objects
+              slotCount - Number of slots in array (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::rebuild(const SegmentedArray<Game>& games, int slotCount) {
+    count = 0;
+    playerIndex.clear();
+    for (int i = 0; i < rowByKey.size(); i++) {
+        rowByKey[i] = -1;
+    }
+    if (slotCount > capacity) {
+        allocateColumns(slotCount);
+    }
+    yearView.clear();
+    titleView.clear();
+    borrowView.clear();
+    for (int i = 0; i < slotCount; i++) {
+        if (games[i].getGameKey() == NO_ID) {
+            clearRow(i);
+            continue;
+        }
+        writeRow(i, games[i]);
+        playerIndex.addGame(i, minPlayers[i], maxPlayers[i]);
+        setRowOfKey(gameKey[i], i);
+        yearView.add(i);
+        titleView.add(i);
+        borrowView.add(i);
+    }
+    count = slotCount;
+    source = &games;
+
+    int live = yearView.size();
+    GameSorter sorter;
+    sorter.sort(games, yearView.data(), live, SORT_BY_YEAR);
+    sorter.sort(games, titleView.data(), live, SORT_BY_TITLE);
+    sorter.sort(games, borrowView.data(), live, SORT_BY_BORROWS_ASC);
+}
+
+/*
+============================================================
+Function    : append
+Description : Adds a row for a game appended to games[] and
+              registers it in the player index and the ordered
+              views. Columns double in size when full.
+Input       : game - Game that was appended; must be the next
+              element of the games[] given to rebuild
+              (const Game&)
+Return      : None
+============================================================
+*/
+void GameCatalog::append(const Game& game) {
+    if (count == capacity) {
+        allocateColumns(capacity * 2);
+    }
+    writeRow(count, game);
+    playerIndex.addGame(count, minPlayers[count], maxPlayers[count]);
+    int row = count;
+    count++;
+    setRowOfKey(gameKey[row], row);
+    viewInsert(yearView, SORT_BY_YEAR, row);
+    viewInsert(titleView, SORT_BY_TITLE, row);
+    viewInsert(borrowView, SORT_BY_BORROWS_ASC, row);
+}
+
+/*
+============================================================
+Function    : update
+Description : Refreshes row 'index' after games[index] changed
+              (status or borrow count). A new borrow count is
+              repaired into the borrow-count view in place.
+Input       : index - Row to refresh (int)
+              game - Updated game (const Game&)
+Return      : None
+============================================================
+*/
+void GameCatalog::update(int index, const Game& game) {
+    if (index < 0 || index >= count) return;
+    if (game.getBorrowCount() == borrowCount[index]) {
+        writeRow(index, game);
+        return;
+    }
+
+    // Locate the row while its old count still orders the view
+    int oldSlot = insertPoint(borrowView, SORT_BY_BORROWS_ASC, index, 0, borrowView.size());
+    writeRow(index, game);
+    viewRepair(borrowView, SORT_BY_BORROWS_ASC, index, oldSlot);
+}
+
+/*
+============================================================
+Function    : place
+Description : Adds a row for a game stored in slot 'index' of
+              games[]: either the next slot (an append) or an
+              empty slot being reused. The row is registered
+              in the player buckets and the ordered views.
+Input       : index - Slot the game was stored in (int)
+              game - The game, already at games[index]
+              (const Game&)
+Return      : None
+============================================================
+*/
+void GameCatalog::place(int index, const Game& game) {
+    if (index == count) {
+        append(game);
+        return;
+    }
+    if (index < 0 || index > count || gameKey[index] != NO_ID) return;
+    writeRow(index, game);
+    playerIndex.changeRange(index, 1, 0, minPlayers[index], maxPlayers[index]);
+    setRowOfKey(gameKey[index], index);
+    viewInsert(yearView, SORT_BY_YEAR, index);
+    viewInsert(titleView, SORT_BY_TITLE, index);
+    viewInsert(borrowView, SORT_BY_BORROWS_ASC, index);
+}
+
+/*
+============================================================
+Function    : release
+Description : Takes the game in row 'index' out of the views
+              and player buckets and clears the row, leaving
+              every other row where it is. Must be called
+              before games[index] is cleared: the views are
+              searched with its title.
+Input       : index - Row of the game being removed (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::release(int index) {
+    if (index < 0 || index >= count || gameKey[index] == NO_ID) return;
+    viewErase(yearView, SORT_BY_YEAR, index);
+    viewErase(titleView, SORT_BY_TITLE, index);
+    viewErase(borrowView, SORT_BY_BORROWS_ASC, index);
+    playerIndex.changeRange(index, minPlayers[index], maxPlayers[index], 1, 0);
+    setRowOfKey(gameKey[index], -1);
+    clearRow(index);
+}
+
+/*
+============================================================
+Function    : size
+Description : Returns the number of rows in the catalog.
+Input       : None
+Return      : Row count, empty slots included (int)
+============================================================
+*/
+int GameCatalog::size() const { return count; }
+
+/*
+============================================================
+Function    : getMinPlayers
+Description : Returns the minimum player count stored in a row.
+Input       : index - Row to read (int)
+Return      : Minimum players (int)
+============================================================
+*/
+int GameCatalog::getMinPlayers(int index) const { return minPlayers[index]; }
+
+/*
+============================================================
+Function    : getMaxPlayers
+Description : Returns the maximum player count stored in a row.
+Input       : index - Row to read (int)
+Return      : Maximum players (int)
+============================================================
+*/
+int GameCatalog::getMaxPlayers(int index) const { return maxPlayers[index]; }
+
+/*
+============================================================
+Function    : getYear
+Description : Returns the year published stored in a row.
+Input       : index - Row to read (int)
+Return      : Year published (int)
+============================================================
+*/
+int GameCatalog::getYear(int index) const { return year[index]; }
+
+/*
+============================================================
+Function    : getBorrowCount
+Description : Returns the borrow count stored in a row.
+Input       : index - Row to read (int)
+Return      : Borrow count (int)
+============================================================
+*/
+int GameCatalog::getBorrowCount(int index) const { return borrowCount[index]; }
+
+/*
+============================================================
+Function    : getStatus
+Description : Returns the status stored in a row.
+Input       : index - Row to read (int)
+Return      : STATUS_AVAILABLE or STATUS_BORROWED
+              (unsigned char)
+============================================================
+*/
+unsigned char GameCatalog::getStatus(int index) const { return status[index]; }
+
+/*
+============================================================
+Function    : findRow
+Description : Finds the row (= games[] position) of a game
+              handle without hashing its string ID.
+Input       : key - Game handle (IdHandle)
+Return      : Row, or -1 if the game is not in the catalog
+              (for example after it was removed) (int)
+============================================================
+*/
+int GameCatalog::findRow(IdHandle key) const {
+    if (key == NO_ID || key >= (IdHandle)rowByKey.size()) return -1;
+    return rowByKey[key];
+}
+
+/*
+============================================================
+Function    : filterByPlayerCount
+Description : Finds every game whose player range includes
+              numPlayers by running the vectorised range
+              kernel over the minPlayers / maxPlayers columns.
+Input       : numPlayers - Target player count (int)
+              outIndices[] - Receives matching rows; must
+              have room for size() entries
+Return      : Number of matching rows (int)
+============================================================
+*/
+int GameCatalog::filterByPlayerCount(int numPlayers, int outIndices[]) const {
+    return filterRangeContains(minPlayers, maxPlayers, count, numPlayers, outIndices);
+}
+
+/*
+============================================================
+Function    : findByPlayerCount
+Description : Looks up the prebuilt bucket of games whose
+              player range includes numPlayers. Costs O(1)
+              regardless of catalog size.
+Input       : numPlayers - Target player count (int)
+Return      : Matching rows in ascending order, or nullptr
+              if the count is outside the indexed range
+              (const DynamicArray<int>*)
+============================================================
+*/
+const DynamicArray<int>* GameCatalog::findByPlayerCount(int numPlayers) const {
+    if (!playerIndex.covers(numPlayers)) return nullptr;
+    return &playerIndex.gamesFor(numPlayers);
+}
+
+/*
+============================================================
+Function    : orderedRows
+Description : Lists every row in the requested order straight
+              from the maintained views, in linear time.
+Input       : mode - Order wanted (SortMode)
+              outRows[] - Receives size() rows
+Return      : Number of rows written (int)
+============================================================
+*/
+int GameCatalog::orderedRows(SortMode mode, int outRows[]) const {
+    if (mode == SORT_BY_BORROWS_DESC) {
+        return mostBorrowed(0, borrowView.size(), outRows);
+    }
+
+    const DynamicArray<int>* view = &borrowView;
+    if (mode == SORT_BY_YEAR) view = &yearView;
+    else if (mode == SORT_BY_TITLE) view = &titleView;
+
+    if (view->size() > 0) memcpy(outRows, view->data(), view->size() * sizeof(int));
+    return view->size();
+}
+
+/*
+============================================================
+Function    : sortRows
+Description : Bottom-up merge sort of a row list by rowBefore,
+              using the catalog's merge buffer. O(n log n) in
+              the size of the list, not of the catalog.
+Input       : mode - Order (SortMode)
+              rows[] - Rows to sort, in place
+              n - Number of rows (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::sortRows(SortMode mode, int rows[], int n) const {
+    if (mergeBuffer.size() < n) mergeBuffer.resize(n);
+    int* from = rows;
+    int* to = mergeBuffer.data();
+
+    for (int width = 1; width < n; width *= 2) {
+        for (int left = 0; left < n; left += 2 * width) {
+            int mid = (left + width < n) ? left + width : n;
+            int right = (left + 2 * width < n) ? left + 2 * width : n;
+            int i = left, j = mid, k = left;
+            while (i < mid && j < right) {
+                to[k++] = rowBefore(mode, from[j], from[i]) ? from[j++] : from[i++];
+            }
+            while (i < mid) to[k++] = from[i++];
+            while (j < right) to[k++] = from[j++];
+        }
+        int* swapped = from;
+        from = to;
+        to = swapped;
+    }
+    if (from != rows) memcpy(rows, from, n * sizeof(int));
+}
+
+/*
+============================================================
+Function    : orderRows
+Description : Puts a set of distinct rows, such as a player
+              bucket, into the order of a view, without
+              touching the rows outside the set when it is
+              small. A set smaller than 1/CATALOG_WALK_FRACTION
+              of the view is merge-sorted by the view's keys,
+              O(k log k); a larger one is marked in a per-row
+              flag array and read off the view in one pass,
+              O(n) with no comparisons. The most-borrowed order
+              is always sorted. Scratch arrays are reused, so
+              a query only allocates when the catalog has grown.
+Input       : mode - Order wanted (SortMode)
+              rows[] - Rows of the set, reordered in place
+              n - Number of rows (int)
+Return      : None
+============================================================
+*/
+void GameCatalog::orderRows(SortMode mode, int rows[], int n) const {
+    const DynamicArray<int>* view = nullptr;
+    if (mode == SORT_BY_YEAR) view = &yearView;
+    else if (mode == SORT_BY_TITLE) view = &titleView;
+    else if (mode == SORT_BY_BORROWS_ASC) view = &borrowView;
+
+    if (view == nullptr || (long long)n * CATALOG_WALK_FRACTION < view->size()) {
+        sortRows(mode, rows, n);
+        return;
+    }
+
+    if (rowMark.size() < count) {
+        int marked = rowMark.size();
+        rowMark.resize(count);
+        memset(rowMark.data() + marked, 0, count - marked);
+    }
+    unsigned char* mark = rowMark.data();
+    for (int i = 0; i < n; i++) mark[rows[i]] = 1;
+
+    int written = 0;
+    const int* slots = view->data();
+    for (int slot = 0; slot < view->size() && written < n; slot++) {
+        int row = slots[slot];
+        if (mark[row]) {
+            mark[row] = 0;
+            rows[written++] = row;
+        }
+    }
+}
+
+/*
+============================================================
+Function    : firstSlotAbove
+Description : Binary search of the borrow-count view for the
+              first slot whose game was borrowed more than
+              'borrows' times.
+Input       : borrows - Borrow count to step past (int)
+Return      : Slot position, size() if none (int)
+============================================================
+*/
+int GameCatalog::firstSlotAbove(int borrows) const {
+    int low = 0, high = borrowView.size();
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (borrowCount[borrowView[mid]] <= borrows) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+/*
+============================================================
+Function    : mostBorrowed
+Description : Reads ranks offset .. offset+limit-1 of the
+              most-borrowed ranking off the ascending borrow-
+              count view, without touching the other rows.
+              The ranking is the view read from the back one
+              equal-count group at a time, each group kept in
+              row order (the same result as a stable sort by
+              descending count). Rank 'offset' is found by
+              mirroring it into the view and binary-searching
+              the bounds of its group, so a page costs
+              O(k + groups x log n) however deep it is.
+Input       : offset - First rank wanted, 0 = most borrowed
+              (int)
+              limit - Maximum number of rows (int)
+              outRows[] - Receives up to 'limit' rows
+Return      : Number of rows written (int)
+============================================================
+*/
+int GameCatalog::mostBorrowed(int offset, int limit, int outRows[]) const {
+    if (offset < 0) offset = 0;
+
+    int rows = borrowView.size();
+    int written = 0;
+    int rank = offset;
+    while (written < limit && rank < rows) {
+        int borrows = borrowCount[borrowView[rows - 1 - rank]];
+        int groupStart = firstSlotAbove(borrows - 1);
+        int groupEnd = firstSlotAbove(borrows) - 1;
+        int groupFirstRank = rows - 1 - groupEnd;
+
+        for (int slot = groupStart + (rank - groupFirstRank); slot <= groupEnd && written < limit; slot++) {
+            outRows[written++] = borrowView[slot];
+            rank++;
+        }
+    }
+    return written;
+}
+
+/*
+============================================================
+Function    : filterRangeContains
+Description : Range-filter kernel. Compares 8 (AVX2) or 4
+              (SSE2) rows per instruction, turns the result
+              into a bit mask and writes the indices of the
+              set bits, so indices come out in ascending
+              order. The remaining tail rows, and builds
+              without SSE2, use the scalar loop.
+Input       : lo[] - Lower bound column
+              hi[] - Upper bound column
+              n - Number of rows (int)
+              value - Value that must lie in [lo, hi] (int)
+              outIndices[] - Receives matching rows (room
+              for n entries)
+Return      : Number of matching rows (int)
+============================================================
+*/
+int filterRangeContains(const int lo[], const int hi[], int n, int value, int outIndices[]) {
+    int found = 0;
+    int i = 0;
+
+#if defined(CATALOG_USE_AVX2)
+    __m256i target8 = _mm256_set1_epi32(value);
+    for (; i + 8 <= n; i += 8) {
+        __m256i lo8 = _mm256_loadu_si256((const __m256i*)(lo + i));
+        __m256i hi8 = _mm256_loadu_si256((const __m256i*)(hi + i));
+        // Row fails when lo > value or value > hi
+        __m256i fail = _mm256_or_si256(_mm256_cmpgt_epi32(lo8, target8),
+            _mm256_cmpgt_epi32(target8, hi8));
+        int mask = ~_mm256_movemask_ps(_mm256_castsi256_ps(fail)) & 0xFF;
+        for (int bit = 0; mask != 0; bit++, mask >>= 1) {
+            if (mask & 1) outIndices[found++] = i + bit;
+        }
+    }
+#elif defined(CATALOG_USE_SSE2)
+    __m128i target4 = _mm_set1_epi32(value);
+    for (; i + 4 <= n; i += 4) {
+        __m128i lo4 = _mm_loadu_si128((const __m128i*)(lo + i));
+        __m128i hi4 = _mm_loadu_si128((const __m128i*)(hi + i));
+        // Row fails when lo > value or value > hi
+        __m128i fail = _mm_or_si128(_mm_cmpgt_epi32(lo4, target4),
+            _mm_cmpgt_epi32(target4, hi4));
+        int mask = ~_mm_movemask_ps(_mm_castsi128_ps(fail)) & 0xF;
+        for (int bit = 0; mask != 0; bit++, mask >>= 1) {
+            if (mask & 1) outIndices[found++] = i + bit;
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        if (lo[i] <= value && hi[i] >= value) {
+            outIndices[found++] = i;
+        }
+    }
+    return found;
+}
@@ -1,7 +1,10 @@
 #include "GameManager.h"
-#include <fstream>
-#include <sstream>
+#include "MappedFile.h"
+#include "CsvScanner.h"
 #include <iostream>
+#include <cstring>
+#include <cctype>
+#include <charconv>
 using namespace std;
 
 /*
@@ -22,109 +25,397 @@ string trim(string str) {
 
 /*
 ============================================================
-Function    : parseCSVField
-Description : Extracts the next field from a CSV line,
-              respecting quotes. Handles commas inside quotes.
-Input       : line - CSV line string (string&)
-              pos - current position in line (size_t&)
-Return      : string - the extracted field
+Function    : printColumn
+Description : Prints text padded with spaces to a fixed column
+              width. Text longer than the width is cut to
+              width - 3 characters followed by "...". Writes
+              straight from the caller's buffer, so printing
+              a table row never allocates.
+Input       : text - Text to print (string_view)
+              width - Column width in characters (int)
+Return      : None
+============================================================
+*/
+void printColumn(string_view text, int width) {
+    int length = (int)text.length();
+    if (length > width) {
+        cout.write(text.data(), width - 3);
+        cout << "...";
+        return;
+    }
+    cout.write(text.data(), length);
+    for (int i = length; i < width; i++) cout << " ";
+}
+
+// ===================== CSV PARSING (zero-copy) =====================
+
+// Characters trim() removes, shared by the field parser
+static bool isTrimSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static string_view trimView(string_view text) {
+    size_t first = 0;
+    size_t last = text.length();
+    while (first < last && isTrimSpace(text[first])) first++;
+    while (last > first && isTrimSpace(text[last - 1])) last--;
+    return text.substr(first, last - first);
+}
+
+/*
+============================================================
+Function    : csvField
+Description : Returns one field of a scanned line with its
+              quotes dropped and trimmed. Fields past the end
+              of the line are empty. A field without quotes
+              is a view into the line itself; one with quotes
+              is unquoted into 'scratch' (whose capacity is
+              reused row after row) and the view points there.
+Input       : line - Line from CsvScanner (const CsvLine&)
+              index - Field number, from 0 (int)
+              scratch - Buffer for quoted fields (string&)
+Return      : The field (string_view)
+============================================================
+*/
+static string_view csvField(const CsvLine& line, int index, string& scratch) {
+    if (index >= line.fieldCount) return string_view();
+
+    const char* start = (index == 0) ? line.begin : line.fieldEnd[index - 1] + 1;
+    const char* stop = line.fieldEnd[index];
+    if (!line.fieldQuoted[index]) return trimView(string_view(start, stop - start));
+
+    // Copy the runs between quotes
+    scratch.clear();
+    const char* run = start;
+    while (run < stop) {
+        const char* quote = (const char*)memchr(run, '"', stop - run);
+        if (quote == nullptr) quote = stop;
+        scratch.append(run, quote - run);
+        run = quote + 1;
+    }
+    return trimView(scratch);
+}
+
+/*
+============================================================
+Function    : parseCSVInt
+Description : Converts a field to int with from_chars, with
+              the same rules stoi applied before: leading
+              white space and a '+' are accepted, trailing
+              characters are ignored, and text without digits
+              or outside the int range is rejected. Never
+              throws.
+Input       : text - Field to convert (string_view)
+              value - Receives the number (int&)
+Return      : False if the field is not a number (bool)
 ============================================================
 */
-string parseCSVField(const string& line, size_t& pos) {
-    string field;
-    bool inQuotes = false;
+static bool parseCSVInt(string_view text, int& value) {
+    const char* p = text.data();
+    const char* end = p + text.length();
+    while (p < end && isspace((unsigned char)*p)) p++;
+    if (p < end && *p == '+') {
+        p++;
+        if (p == end || !isdigit((unsigned char)*p)) return false;
+    }
+    from_chars_result result = from_chars(p, end, value);
+    return result.ec == errc();
+}
 
-    while (pos < line.length()) {
-        char c = line[pos];
+/*
+============================================================
+Function    : parseCSVRow
+Description : Splits one non-blank CSV line into a game row:
+              title, min/max players, max/min playtime and
+              year, in file column order. Name, player and
+              year fields must be present; empty playtimes
+              read as 0.
+Input       : line - Line from CsvScanner (const CsvLine&)
+              scratch - Six unquoting buffers (string[])
+              row - Receives the fields (CsvRow&)
+Return      : CSV_ROW_OK or why the row was rejected
+              (CsvRowStatus)
+============================================================
+*/
+static CsvRowStatus parseCSVRow(const CsvLine& line, string scratch[], CsvRow& row) {
+    string_view name = csvField(line, 0, scratch[0]);
+    string_view minP = csvField(line, 1, scratch[1]);
+    string_view maxP = csvField(line, 2, scratch[2]);
+    string_view maxTime = csvField(line, 3, scratch[3]);
+    string_view minTime = csvField(line, 4, scratch[4]);
+    string_view year = csvField(line, 5, scratch[5]);
+
+    // Validate
+    if (name.empty() || minP.empty() || maxP.empty() || year.empty()) {
+        return CSV_ROW_MISSING;
+    }
 
-        if (c == '"') {
-            inQuotes = !inQuotes;
-            pos++;
+    row.title = name;
+    row.minPlaytime = 0;
+    row.maxPlaytime = 0;
+    if (!parseCSVInt(minP, row.minPlayers) || !parseCSVInt(maxP, row.maxPlayers) ||
+        (!minTime.empty() && !parseCSVInt(minTime, row.minPlaytime)) ||
+        (!maxTime.empty() && !parseCSVInt(maxTime, row.maxPlaytime)) ||
+        !parseCSVInt(year, row.year)) {
+        return CSV_ROW_BAD_NUMBER;
+    }
+    return CSV_ROW_OK;
+}
+
+/*
+============================================================
+Function    : formatGameID
+Description : Builds the ID of the game numbered 'number':
+              G001, G002, ... G999, G1000.
+Input       : number - Game number, from 1 (int)
+Return      : The game ID (string)
+============================================================
+*/
+string formatGameID(int number) {
+    char idBuffer[16] = { 'G', '0', '0' };
+    int padding = (number < 10) ? 2 : (number < 100) ? 1 : 0;
+    char* idEnd = to_chars(idBuffer + 1 + padding, idBuffer + sizeof(idBuffer), number).ptr;
+    return string(idBuffer, idEnd);
+}
+
+/*
+============================================================
+Function    : addCSVRow
+Description : Takes one parsed row in file order: counts it,
+              and if it is valid stores it as the next game.
+              The file has no ID column, so IDs are numbered
+              by position (see formatGameID) and only depend
+              on file order.
+Input       : status - Parse result (CsvRowStatus)
+              row - The row's fields (const CsvRow&)
+              games - Array the game is appended to
+              count - Games stored so far (int&)
+              counters - Row counters (CsvLoadStats&)
+Return      : None
+============================================================
+*/
+static void addCSVRow(CsvRowStatus status, const CsvRow& row, SegmentedArray<Game>& games, int& count,
+    CsvLoadStats& counters) {
+    counters.rowsRead++;
+    if (status == CSV_ROW_MISSING) {
+        counters.missingFields++;
+        return;
+    }
+    if (status == CSV_ROW_BAD_NUMBER) {
+        counters.badNumbers++;
+        return;
+    }
+
+    games.add(Game(formatGameID(count + 1), string(row.title), row.minPlayers, row.maxPlayers,
+        row.minPlaytime, row.maxPlaytime, row.year));
+    count++;
+}
+
+// ===================== PARALLEL INGESTION =====================
+
+// One parsed row kept by a chunk until the rows are stitched
+struct CsvChunkRow {
+    CsvRowStatus status;
+    const char* titleData;   // title inside the mapping, or nullptr
+    int titleOffset;         // else its offset in the chunk's titles
+    int titleLength;
+    int minPlayers, maxPlayers, minPlaytime, maxPlaytime, year;
+};
+
+// A byte range of whole lines and the rows parsed from it
+struct CsvChunk {
+    const char* begin;
+    const char* end;
+    DynamicArray<CsvChunkRow> rows;
+    DynamicArray<char> titles;   // unquoted titles
+};
+
+/*
+============================================================
+Function    : parseChunkTask
+Description : Parses every non-blank line of one chunk into
+              the chunk's own row buffer. Titles that had
+              quotes are copied into the chunk's title buffer;
+              all others stay as pointers into the mapping.
+Input       : arg - The CsvChunk (void*)
+Return      : None
+============================================================
+*/
+static void parseChunkTask(void* arg) {
+    CsvChunk* chunk = (CsvChunk*)arg;
+    string scratch[6];
+    CsvScanner scanner(chunk->begin, chunk->end);
+    CsvLine line;
+
+    while (scanner.nextLine(line)) {
+        if (trimView(string_view(line.begin, line.end - line.begin)).empty()) continue;
+
+        CsvRow row;
+        CsvChunkRow kept;
+        kept.status = parseCSVRow(line, scratch, row);
+        kept.titleData = nullptr;
+        kept.titleOffset = 0;
+        kept.titleLength = 0;
+        if (kept.status == CSV_ROW_OK) {
+            kept.titleLength = (int)row.title.length();
+            if (row.title.data() >= line.begin && row.title.data() < line.end) {
+                kept.titleData = row.title.data();
+            }
+            else {
+                kept.titleOffset = chunk->titles.size();
+                chunk->titles.resize(kept.titleOffset + kept.titleLength);
+                memcpy(chunk->titles.data() + kept.titleOffset, row.title.data(), kept.titleLength);
+            }
+            kept.minPlayers = row.minPlayers;
+            kept.maxPlayers = row.maxPlayers;
+            kept.minPlaytime = row.minPlaytime;
+            kept.maxPlaytime = row.maxPlaytime;
+            kept.year = row.year;
         }
-        else if (c == ',' && !inQuotes) {
-            pos++; // Skip the comma
-            break;
+        chunk->rows.add(kept);
+    }
+}
+
+/*
+============================================================
+Function    : loadRowsParallel
+Description : Splits the data lines into about four chunks per
+              thread, cut just after a '\n'. The parser ends a
+              row at every '\n', even inside quotes (a quoted
+              field never continues onto the next line), so a
+              cut at any line end splits exactly where the
+              sequential loader would. The chunks are parsed
+              on the pool, then stitched in file order on this
+              thread, so Game IDs and interned handles come
+              out the same as a sequential load.
+Input       : begin - First data byte (const char*)
+              end - End of the file (const char*)
+              games - Array the games are appended to
+              counters - Row counters (CsvLoadStats&)
+              pool - Threads to parse on (TaskPool&)
+Return      : Number of games stored (int)
+============================================================
+*/
+static int loadRowsParallel(const char* begin, const char* end, SegmentedArray<Game>& games,
+    CsvLoadStats& counters, TaskPool& pool) {
+    long long dataSize = end - begin;
+    int chunkCount = pool.threadCount() * 4;
+    if (chunkCount > dataSize / CSV_CHUNK_MIN_BYTES) chunkCount = (int)(dataSize / CSV_CHUNK_MIN_BYTES);
+    if (chunkCount < 1) chunkCount = 1;
+
+    CsvChunk* chunks = new CsvChunk[chunkCount];
+    const char* cut = begin;
+    for (int c = 0; c < chunkCount; c++) {
+        chunks[c].begin = cut;
+        if (c == chunkCount - 1) {
+            cut = end;
         }
         else {
-            field += c;
-            pos++;
+            const char* target = begin + dataSize * (c + 1) / chunkCount;
+            if (target < cut) target = cut;
+            const char* newline = (const char*)memchr(target, '\n', end - target);
+            cut = (newline == nullptr) ? end : newline + 1;
+        }
+        chunks[c].end = cut;
+    }
+
+    TaskGroup group;
+    for (int c = 0; c < chunkCount; c++) {
+        pool.spawn(group, parseChunkTask, &chunks[c]);
+    }
+    pool.wait(group);
+
+    int count = 0;
+    for (int c = 0; c < chunkCount; c++) {
+        const CsvChunk& chunk = chunks[c];
+        for (int r = 0; r < chunk.rows.size(); r++) {
+            const CsvChunkRow& kept = chunk.rows[r];
+            CsvRow row;
+            const char* title = (kept.titleData != nullptr) ? kept.titleData
+                : chunk.titles.data() + kept.titleOffset;
+            row.title = string_view(title, kept.titleLength);
+            row.minPlayers = kept.minPlayers;
+            row.maxPlayers = kept.maxPlayers;
+            row.minPlaytime = kept.minPlaytime;
+            row.maxPlaytime = kept.maxPlaytime;
+            row.year = kept.year;
+            addCSVRow(kept.status, row, games, count, counters);
         }
     }
 
-    return trim(field);
+    delete[] chunks;
+    return count;
 }
 
 /*
 ============================================================
 Function    : loadGamesFromCSV
-Description : Reads a CSV file and loads game data into the
-              games array. Parses each line, validates data,
-              generates Game IDs, and creates Game objects.
-              Handles quoted game names and empty fields.
+Description : Memory-maps a CSV file and loads game data into
+              the games array, replacing its contents; the
+              array grows with the file, so there is no row
+              limit. CsvScanner finds line and field
+              boundaries a 64-byte block at a time, fields are
+              used in place (see csvField) and numbers are read
+              with from_chars, so a row costs no allocations
+              beyond the Game it creates. Generates Game IDs
+              and counts the rows it rejects: missing name,
+              player or year fields and fields that are not
+              numbers. Given a pool with several threads,
+              files of at least CSV_PARALLEL_MIN_BYTES are
+              parsed in parallel chunks with the same result.
 Input       : filename - Path to CSV file (string)
-              games[] - Array to store Game objects
-              maxSize - Maximum capacity of games array (int)
+              games - Array to load the games into
+              stats - Receives the row counters, may be
+              nullptr (CsvLoadStats*)
+              pool - Threads for large files, or nullptr to
+              parse sequentially (TaskPool*)
 Return      : Number of games successfully loaded (int)
 ============================================================
 */
-int loadGamesFromCSV(string filename, Game games[], int maxSize) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+int loadGamesFromCSV(string filename, SegmentedArray<Game>& games, CsvLoadStats* stats, TaskPool* pool) {
+    CsvLoadStats counters = {};
+    games.clear();
+
+    MappedFile file;
+    if (!file.open(filename.c_str())) {
         cout << "ERROR: Cannot open " << filename << endl;
+        if (stats != nullptr) *stats = counters;
         return 0;
     }
 
-    string line;
-    getline(file, line); // Skip header
+    const char* pos = file.data();
+    const char* end = pos + file.size();
+
+    // Skip header
+    const char* newline = (const char*)memchr(pos, '\n', end - pos);
+    pos = (newline == nullptr) ? end : newline + 1;
 
     int count = 0;
-    int autoIdCounter = 1;
-
-    while (getline(file, line) && count < maxSize) {
-        line = trim(line);
-        if (line.empty()) continue;
-
-        // Parse CSV fields manually without STL
-        size_t pos = 0;
-        string name = parseCSVField(line, pos);
-        string minP = parseCSVField(line, pos);
-        string maxP = parseCSVField(line, pos);
-        string maxTime = parseCSVField(line, pos);
-        string minTime = parseCSVField(line, pos);
-        string year = parseCSVField(line, pos);
-
-        // Validate
-        if (name.empty() || minP.empty() || maxP.empty() || year.empty()) {
-            continue;
-        }
+    if (pool != nullptr && pool->threadCount() > 1 && end - pos >= CSV_PARALLEL_MIN_BYTES) {
+        count = loadRowsParallel(pos, end, games, counters, *pool);
+    }
+    else {
+        string scratch[6];   // unquoting buffers, one per field
+        CsvScanner scanner(pos, end);
+        CsvLine line;
+        while (scanner.nextLine(line)) {
+            if (trimView(string_view(line.begin, line.end - line.begin)).empty()) continue;
 
-        // Generate Game ID
-        string gameID = "G";
-        if (autoIdCounter < 10) gameID += "00";
-        else if (autoIdCounter < 100) gameID += "0";
-        gameID += to_string(autoIdCounter);
-
-        // Convert to integers with error checking
-        try {
-            int minPlayers = stoi(minP);
-            int maxPlayers = stoi(maxP);
-            int minPlaytime = (minTime.empty() ? 0 : stoi(minTime));
-            int maxPlaytime = (maxTime.empty() ? 0 : stoi(maxTime));
-            int yearPub = stoi(year);
-
-            games[count] = Game(gameID, name, minPlayers, maxPlayers,
-                minPlaytime, maxPlaytime, yearPub);
-            count++;
-            autoIdCounter++;
-        }
-        catch (...) {
-            // Skip this game if conversion fails
-            continue;
+            CsvRow row;
+            CsvRowStatus status = parseCSVRow(line, scratch, row);
+            addCSVRow(status, row, games, count, counters);
         }
     }
 
-    file.close();
+    counters.loaded = count;
+    if (stats != nullptr) *stats = counters;
+
     cout << "\n*** Loaded " << count << " games successfully! ***\n";
+    int rejected = counters.missingFields + counters.badNumbers;
+    if (rejected > 0) {
+        cout << "Skipped " << rejected << " row(s): " << counters.missingFields
+            << " with missing fields, " << counters.badNumbers << " with invalid numbers.\n";
+    }
     return count;
 }
 
@@ -133,16 +424,26 @@ int loadGamesFromCSV(string filename, Game games[], int maxSize) {
 Function    : buildHashTable
 Description : Populates the hash table with game IDs and
               their corresponding array indices for fast
-              O(1) game lookups.
+              O(1) game lookups. Replaces any previous
+              contents. With a pool, large tables are built
+              in parallel, one slot range per thread.
 Input       : games[] - Array of Game objects
               gameCount - Number of games in array (int)
               hashTable - HashTable object (passed by reference)
+              pool - Threads to use, or nullptr (TaskPool*)
 Return      : None
 ============================================================
 */
-void buildHashTable(Game games[], int gameCount, HashTable& hashTable) {
+void buildHashTable(SegmentedArray<Game>& games, int gameCount, HashTable& hashTable, TaskPool* pool) {
+    string_view* ids = new string_view[gameCount > 0 ? gameCount : 1];
+    int* positions = new int[gameCount > 0 ? gameCount : 1];
     for (int i = 0; i < gameCount; i++) {
-        hashTable.insert(games[i].getGameID(), i);
+        ids[i] = games[i].getGameID();
+        positions[i] = i;
     }
+    hashTable.build(ids, positions, gameCount, pool);
+    delete[] ids;
+    delete[] positions;
+
     cout << "Hash table built with " << gameCount << " games." << endl;
-}
\ No newline at end of file
+}
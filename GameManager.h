@@ -2,21 +2,55 @@
 #define GAMEMANAGER_H
 
 #include <string>
+#include <string_view>
 #include "Game.h"
 #include "HashTable.h"
+#include "TaskPool.h"
+#include "SegmentedArray.h"
 
 using namespace std;
 
 // Helper function to trim whitespace
 string trim(string str);
 
-// Helper function to parse a single CSV field respecting quotes
-string parseCSVField(const string& line, size_t& pos);
+// Helper function to print text in a fixed-width table column,
+// cutting it with "..." when it is too long (no string copies)
+void printColumn(string_view text, int width);
 
-// Load games from CSV file
-int loadGamesFromCSV(string filename, Game games[], int maxSize);
+const int CSV_PARALLEL_MIN_BYTES = 1 << 20;   // smaller files are parsed on one thread
+const int CSV_CHUNK_MIN_BYTES = 256 * 1024;   // smallest byte range given to a worker
 
-// Build hash table from loaded games
-void buildHashTable(Game games[], int gameCount, HashTable& hashTable);
+// Outcome of parsing one CSV data line
+enum CsvRowStatus { CSV_ROW_OK, CSV_ROW_MISSING, CSV_ROW_BAD_NUMBER };
+
+// Fields of one game row (title may point into a scratch buffer)
+struct CsvRow {
+    string_view title;
+    int minPlayers;
+    int maxPlayers;
+    int minPlaytime;
+    int maxPlaytime;
+    int year;
+};
+
+// Rows seen and rejected by loadGamesFromCSV (blank lines are not counted)
+struct CsvLoadStats {
+    int rowsRead;        // data rows parsed
+    int loaded;          // rows that became games
+    int missingFields;   // empty name, player or year field
+    int badNumbers;      // numeric field that is not an int
+};
+
+// Game ID for a game number (G001 ... G999, G1000)
+string formatGameID(int number);
+
+// Load games from CSV file, replacing the array's contents
+// (memory-mapped, parsed in place; large files in parallel chunks
+// when given a pool)
+int loadGamesFromCSV(string filename, SegmentedArray<Game>& games, CsvLoadStats* stats = nullptr,
+    TaskPool* pool = nullptr);
+
+// Build hash table from loaded games (partitioned by slot range when given a pool)
+void buildHashTable(SegmentedArray<Game>& games, int gameCount, HashTable& hashTable, TaskPool* pool = nullptr);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "GameResultSet.h"
+using namespace std;
+
+/*
+============================================================
+Function    : GameResultSet (Constructor)
+Description : Creates an empty result set over a games array.
+Input       : games[] - Array the results point into
+Return      : None
+============================================================
+*/
+GameResultSet::GameResultSet(const SegmentedArray<Game>& games) {
+    this->games = &games;
+}
+
+/*
+============================================================
+Function    : add
+Description : Appends the position of a matching game.
+Input       : index - Position in games[] (int)
+Return      : None
+============================================================
+*/
+void GameResultSet::add(int index) {
+    indices.add(index);
+}
+
+/*
+============================================================
+Function    : clear
+Description : Removes all results, keeping the buffer.
+Input       : None
+Return      : None
+============================================================
+*/
+void GameResultSet::clear() {
+    indices.clear();
+}
+
+/*
+============================================================
+Function    : size
+Description : Returns the number of results.
+Input       : None
+Return      : Result count (int)
+============================================================
+*/
+int GameResultSet::size() const {
+    return indices.size();
+}
+
+/*
+============================================================
+Function    : isEmpty
+Description : Checks if the search found nothing.
+Input       : None
+Return      : True if there are no results (bool)
+============================================================
+*/
+bool GameResultSet::isEmpty() const {
+    return indices.isEmpty();
+}
+
+/*
+============================================================
+Function    : indexAt
+Description : Returns the games[] position of a result.
+Input       : position - Result number, 0-based (int)
+Return      : Position in games[] (int)
+============================================================
+*/
+int GameResultSet::indexAt(int position) const {
+    return indices[position];
+}
+
+/*
+============================================================
+Function    : at
+Description : Returns the game for a result, read in place.
+Input       : position - Result number, 0-based (int)
+Return      : The game (const Game&)
+============================================================
+*/
+const Game& GameResultSet::at(int position) const {
+    return (*games)[indices[position]];
+}
+
+/*
+============================================================
+Function    : data
+Description : Gives the position array to sort routines, which
+              reorder results by permuting positions.
+Input       : None
+Return      : Pointer to the first position (int*)
+============================================================
+*/
+int* GameResultSet::data() {
+    return indices.data();
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "Game.h"
+#include "DynamicArray.h"
+#include "SegmentedArray.h"
+
+/*
+============================================================
+Class       : GameResultSet
+Description : Result of a search: positions into the games[]
+              array rather than copies of the Game objects.
+              Sorting permutes the positions only, and display
+              reads each game in place. Grows as needed, so
+              there is no fixed cap on the number of results.
+              games[] is a slot map, so positions stay valid
+              while other games are added or removed; only the
+              slot of a removed game is emptied (and may later
+              be reused).
+============================================================
+*/
+class GameResultSet {
+private:
+    const SegmentedArray<Game>* games;   // array the positions point into
+    DynamicArray<int> indices;           // positions into games[]
+
+public:
+    GameResultSet(const SegmentedArray<Game>& games);
+
+    void add(int index);
+    void clear();
+
+    int size() const;
+    bool isEmpty() const;
+    int indexAt(int position) const;
+    const Game& at(int position) const;
+    int* data();
+};
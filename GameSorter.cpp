@@ -0,0 +1,353 @@
+#include "GameSorter.h"
+#include <cstring>
+using namespace std;
+
+/*
+============================================================
+Function    : GameSorter (Constructor)
+Description : Creates a sorter with empty buffers; they are
+              sized by the first sort and then reused. Large
+              sorts use the shared pool until another one is
+              set.
+Input       : None
+Return      : None
+============================================================
+*/
+GameSorter::GameSorter() {
+    compareTitles = false;
+    parallel = true;
+    pool = nullptr;
+}
+
+/*
+============================================================
+Function    : setParallel
+Description : Turns the multi-threaded path for large inputs
+              on or off.
+Input       : enabled - True to allow parallel sorting (bool)
+Return      : None
+============================================================
+*/
+void GameSorter::setParallel(bool enabled) {
+    parallel = enabled;
+}
+
+/*
+============================================================
+Function    : setThreadPool
+Description : Chooses the pool used for large inputs.
+Input       : workers - Pool to run on, or nullptr for the
+              shared pool (TaskPool*)
+Return      : None
+============================================================
+*/
+void GameSorter::setThreadPool(TaskPool* workers) {
+    pool = workers;
+}
+
+/*
+============================================================
+Function    : titleCollationKey
+Description : Packs the first 8 bytes of a title into an
+              integer, most significant byte first, padding
+              short titles with zero bytes. Comparing two keys
+              gives the same result as comparing the titles
+              byte by byte, except that equal keys still need
+              the full strings to break the tie.
+Input       : title - Title to encode (const string&)
+Return      : Collation prefix (uint64_t)
+============================================================
+*/
+uint64_t titleCollationKey(const string& title) {
+    uint64_t key = 0;
+    size_t length = title.length();
+    for (size_t i = 0; i < 8; i++) {
+        unsigned char c = (i < length) ? (unsigned char)title[i] : 0;
+        key = (key << 8) | c;
+    }
+    return key;
+}
+
+/*
+============================================================
+Function    : buildKeys
+Description : Reads the sort keys of games[indices[k]] into
+              slot k of the key arrays and resets the
+              permutation to 0..n-1. Descending borrow order
+              stores the negated count so every mode compares
+              ascending.
+Input       : games[] - Array the indices point into
+              indices[] - Positions to sort
+              n - Number of positions (int)
+              mode - Ordering to apply (SortMode)
+Return      : None
+============================================================
+*/
+void GameSorter::buildKeys(const SegmentedArray<Game>& games, const int indices[], int n, SortMode mode) {
+    compareTitles = (mode == SORT_BY_YEAR || mode == SORT_BY_TITLE);
+
+    primaryKey.resize(n);
+    order.resize(n);
+    scratch.resize(n);
+    if (compareTitles) {
+        titleKey.resize(n);
+        titles.resize(n);
+    }
+
+    for (int k = 0; k < n; k++) {
+        const Game& game = games[indices[k]];
+        switch (mode) {
+        case SORT_BY_YEAR:         primaryKey[k] = game.getYear(); break;
+        case SORT_BY_BORROWS_DESC: primaryKey[k] = -game.getBorrowCount(); break;
+        case SORT_BY_BORROWS_ASC:  primaryKey[k] = game.getBorrowCount(); break;
+        default:                   primaryKey[k] = 0; break;
+        }
+        if (compareTitles) {
+            titles[k] = &game.getTitle();
+            titleKey[k] = titleCollationKey(game.getTitle());
+        }
+        order[k] = k;
+    }
+}
+
+/*
+============================================================
+Function    : comesBefore
+Description : Strict ordering on two key slots: primary key
+              first, then (for year and title modes) the title
+              prefix, then the full title when the prefixes
+              are equal.
+Input       : a - First key slot (int)
+              b - Second key slot (int)
+Return      : True if slot a sorts strictly before slot b
+              (bool)
+============================================================
+*/
+bool GameSorter::comesBefore(int a, int b) const {
+    if (primaryKey[a] != primaryKey[b]) return primaryKey[a] < primaryKey[b];
+    if (!compareTitles) return false;
+    if (titleKey[a] != titleKey[b]) return titleKey[a] < titleKey[b];
+    return *titles[a] < *titles[b];
+}
+
+/*
+============================================================
+Function    : mergeRuns
+Description : Merges order[left..mid] and order[mid+1..right]
+              through the scratch buffer. On equal keys the
+              left run wins, which keeps the sort stable.
+Input       : left - Start of the first run (int)
+              mid - End of the first run (int)
+              right - End of the second run (int)
+Return      : None
+============================================================
+*/
+void GameSorter::mergeRuns(int left, int mid, int right) {
+    int* items = order.data();
+    int* buffer = scratch.data();
+
+    // Already in order: nothing to move
+    if (!comesBefore(items[mid + 1], items[mid])) return;
+
+    memcpy(buffer + left, items + left, (right - left + 1) * sizeof(int));
+    mergeSequential(left, mid, mid + 1, right, left);
+}
+
+/*
+============================================================
+Function    : mergeSequential
+Description : Merges scratch[lo1..hi1] and scratch[lo2..hi2]
+              into order[] starting at dest. Either run may be
+              empty (hi < lo). Ties take from the first run.
+Input       : lo1, hi1 - First run in scratch (int)
+              lo2, hi2 - Second run in scratch (int)
+              dest - First output position in order (int)
+Return      : None
+============================================================
+*/
+void GameSorter::mergeSequential(int lo1, int hi1, int lo2, int hi2, int dest) {
+    int* items = order.data();
+    const int* buffer = scratch.data();
+
+    int i = lo1, j = lo2, k = dest;
+    while (i <= hi1 && j <= hi2) {
+        if (comesBefore(buffer[j], buffer[i])) items[k++] = buffer[j++];
+        else                                   items[k++] = buffer[i++];
+    }
+    while (i <= hi1) items[k++] = buffer[i++];
+    while (j <= hi2) items[k++] = buffer[j++];
+}
+
+/*
+============================================================
+Function    : mergeParallel
+Description : Parallel version of mergeSequential. Takes the
+              middle item of the longer run as a pivot, binary
+              searches where it lands in the other run, writes
+              it straight to its final slot and merges the two
+              sides as independent tasks. Items equal to the
+              pivot stay on the side that keeps first-run
+              items first, so the split never changes the
+              result.
+Input       : workers - Pool to fork onto (TaskPool&)
+              lo1, hi1 - First run in scratch (int)
+              lo2, hi2 - Second run in scratch (int)
+              dest - First output position in order (int)
+Return      : None
+============================================================
+*/
+void GameSorter::mergeParallel(TaskPool& workers, int lo1, int hi1, int lo2, int hi2, int dest) {
+    int n1 = hi1 - lo1 + 1;
+    int n2 = hi2 - lo2 + 1;
+    if (n1 + n2 < SORT_PARALLEL_CUTOFF) {
+        mergeSequential(lo1, hi1, lo2, hi2, dest);
+        return;
+    }
+
+    const int* buffer = scratch.data();
+    int split1, split2;   // first item of each run that goes after the pivot
+    int leftEnd1, leftEnd2;
+    int pivot;
+
+    if (n1 >= n2) {
+        // Pivot from the first run: second-run items strictly before it go left
+        int p = lo1 + n1 / 2;
+        pivot = buffer[p];
+        int lo = lo2, hi = hi2 + 1;
+        while (lo < hi) {
+            int m = lo + (hi - lo) / 2;
+            if (comesBefore(buffer[m], pivot)) lo = m + 1;
+            else hi = m;
+        }
+        leftEnd1 = p - 1;
+        leftEnd2 = lo - 1;
+        split1 = p + 1;
+        split2 = lo;
+    }
+    else {
+        // Pivot from the second run: first-run items not after it go left
+        int q = lo2 + n2 / 2;
+        pivot = buffer[q];
+        int lo = lo1, hi = hi1 + 1;
+        while (lo < hi) {
+            int m = lo + (hi - lo) / 2;
+            if (comesBefore(pivot, buffer[m])) hi = m;
+            else lo = m + 1;
+        }
+        leftEnd1 = lo - 1;
+        leftEnd2 = q - 1;
+        split1 = lo;
+        split2 = q + 1;
+    }
+
+    int pivotSlot = dest + (leftEnd1 - lo1 + 1) + (leftEnd2 - lo2 + 1);
+    order[pivotSlot] = pivot;
+
+    MergeJob job = { this, &workers, lo1, leftEnd1, lo2, leftEnd2, dest };
+    TaskGroup group;
+    workers.spawn(group, mergeTask, &job);
+    mergeParallel(workers, split1, hi1, split2, hi2, pivotSlot + 1);
+    workers.wait(group);
+}
+
+/*
+============================================================
+Function    : sortRangeParallel
+Description : Parallel merge sort over order[left..right]. The
+              left half is forked as a task while this thread
+              sorts the right half; small runs fall back to
+              the sequential sort.
+Input       : workers - Pool to fork onto (TaskPool&)
+              left - Start index (int)
+              right - End index (int)
+Return      : None
+============================================================
+*/
+void GameSorter::sortRangeParallel(TaskPool& workers, int left, int right) {
+    if (right - left + 1 < SORT_PARALLEL_CUTOFF) {
+        sortRange(left, right);
+        return;
+    }
+
+    int mid = left + (right - left) / 2;
+    SortJob job = { this, &workers, left, mid };
+    TaskGroup group;
+    workers.spawn(group, sortTask, &job);
+    sortRangeParallel(workers, mid + 1, right);
+    workers.wait(group);
+
+    int* items = order.data();
+    if (!comesBefore(items[mid + 1], items[mid])) return;
+    memcpy(scratch.data() + left, items + left, (right - left + 1) * sizeof(int));
+    mergeParallel(workers, left, mid, mid + 1, right, left);
+}
+
+/*
+============================================================
+Function    : sortTask / mergeTask
+Description : Task entry points that unpack a SortJob or
+              MergeJob and run it.
+Input       : arg - The job (void*)
+Return      : None
+============================================================
+*/
+void GameSorter::sortTask(void* arg) {
+    SortJob* job = (SortJob*)arg;
+    job->sorter->sortRangeParallel(*job->pool, job->left, job->right);
+}
+
+void GameSorter::mergeTask(void* arg) {
+    MergeJob* job = (MergeJob*)arg;
+    job->sorter->mergeParallel(*job->pool, job->lo1, job->hi1, job->lo2, job->hi2, job->dest);
+}
+
+/*
+============================================================
+Function    : sortRange
+Description : Recursive merge sort over order[left..right].
+Input       : left - Start index (int)
+              right - End index (int)
+Return      : None
+============================================================
+*/
+void GameSorter::sortRange(int left, int right) {
+    if (left >= right) return;
+    int mid = left + (right - left) / 2;
+    sortRange(left, mid);
+    sortRange(mid + 1, right);
+    mergeRuns(left, mid, right);
+}
+
+/*
+============================================================
+Function    : sort
+Description : Sorts indices[0..n-1] (positions into games[])
+              by the chosen ordering. Equal games keep their
+              relative order. Large inputs are sorted on the
+              thread pool when parallel sorting is enabled.
+Input       : games[] - Array the indices point into
+              indices[] - Positions to reorder in place
+              n - Number of positions (int)
+              mode - Ordering to apply (SortMode)
+Return      : None
+============================================================
+*/
+void GameSorter::sort(const SegmentedArray<Game>& games, int indices[], int n, SortMode mode) {
+    if (n < 2) return;
+
+    buildKeys(games, indices, n, mode);
+    if (parallel && n >= SORT_PARALLEL_CUTOFF) {
+        TaskPool& workers = (pool != nullptr) ? *pool : sharedTaskPool();
+        sortRangeParallel(workers, 0, n - 1);
+    }
+    else {
+        sortRange(0, n - 1);
+    }
+
+    // Apply the permutation: scratch is free again once sorting is done
+    int* buffer = scratch.data();
+    for (int k = 0; k < n; k++) {
+        buffer[k] = indices[order[k]];
+    }
+    memcpy(indices, buffer, n * sizeof(int));
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include "Game.h"
+#include "DynamicArray.h"
+#include "SegmentedArray.h"
+#include "TaskPool.h"
+using namespace std;
+
+const int SORT_PARALLEL_CUTOFF = 4096;   // smaller runs are sorted/merged on one thread
+
+// Orderings supported by the sort engine
+enum SortMode {
+    SORT_BY_YEAR,          // oldest first, ties by title
+    SORT_BY_TITLE,         // A - Z
+    SORT_BY_BORROWS_DESC,  // most borrowed first
+    SORT_BY_BORROWS_ASC    // least borrowed first
+};
+
+/*
+============================================================
+Class       : GameSorter
+Description : Stable merge sort over positions into a games[]
+              array. The sort keys (year or borrow count, plus
+              a title collation key) are read out of the games
+              once up front, and the merge passes then permute
+              32-bit indices against those key arrays using a
+              single scratch buffer. Games are never copied and
+              the buffers are kept between sorts, so repeated
+              sorts of similar size do not allocate.
+              Inputs of SORT_PARALLEL_CUTOFF items or more are
+              sorted on a TaskPool: the two halves of each
+              large run are sorted as separate tasks and large
+              merges are split around a binary-searched pivot.
+              Ties still go to the left run, so the result is
+              identical to the sequential sort.
+============================================================
+*/
+class GameSorter {
+private:
+    DynamicArray<int> primaryKey;          // year / borrow count per item
+    DynamicArray<uint64_t> titleKey;       // collation prefix per item
+    DynamicArray<const string*> titles;    // full title for prefix ties
+    DynamicArray<int> order;               // permutation being sorted
+    DynamicArray<int> scratch;             // merge buffer
+    bool compareTitles;
+    bool parallel;
+    TaskPool* pool;                        // nullptr: shared pool
+
+    // Arguments of a forked half-sort or half-merge
+    struct SortJob {
+        GameSorter* sorter;
+        TaskPool* pool;
+        int left, right;
+    };
+    struct MergeJob {
+        GameSorter* sorter;
+        TaskPool* pool;
+        int lo1, hi1, lo2, hi2, dest;
+    };
+
+    void buildKeys(const SegmentedArray<Game>& games, const int indices[], int n, SortMode mode);
+    bool comesBefore(int a, int b) const;
+    void sortRange(int left, int right);
+    void mergeRuns(int left, int mid, int right);
+    void mergeSequential(int lo1, int hi1, int lo2, int hi2, int dest);
+    void sortRangeParallel(TaskPool& workers, int left, int right);
+    void mergeParallel(TaskPool& workers, int lo1, int hi1, int lo2, int hi2, int dest);
+    static void sortTask(void* arg);
+    static void mergeTask(void* arg);
+
+public:
+    GameSorter();
+
+    void sort(const SegmentedArray<Game>& games, int indices[], int n, SortMode mode);
+    void setParallel(bool enabled);
+    void setThreadPool(TaskPool* workers);
+};
+
+// First 8 bytes of a title packed big-endian, so integer order
+// matches string order whenever the keys differ
+uint64_t titleCollationKey(const string& title);
@@ -0,0 +1,56 @@
+#include "HashMap.h"
+using namespace std;
+
+/*
+============================================================
+Function    : mixBits
+Description : Avalanche finalizer (MurmurHash3 fmix32) so
+              that inputs differing in a single bit land in
+              unrelated slots.
+Input       : h - Partially mixed hash (unsigned int)
+Return      : Mixed hash (unsigned int)
+============================================================
+*/
+static unsigned int mixBits(unsigned int h) {
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/*
+============================================================
+Function    : hashBytes
+Description : Hashes a byte string with FNV-1a followed by
+              an avalanche finalizer, so that similar IDs
+              ("G001", "G010", "G100") spread across the
+              whole table.
+Input       : data - Bytes to hash (const char*)
+              length - Number of bytes (size_t)
+Return      : Hash value (unsigned int)
+============================================================
+*/
+unsigned int hashBytes(const char* data, size_t length) {
+    unsigned int h = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        h ^= (unsigned char)data[i];
+        h *= 16777619u;
+    }
+    return mixBits(h);
+}
+
+/*
+============================================================
+Function    : hashUInt
+Description : Hashes an integer key. Dense keys (0, 1, 2...)
+              must not map to neighbouring slots, otherwise
+              linear probing builds long runs.
+Input       : x - Integer to hash (unsigned int)
+Return      : Hash value (unsigned int)
+============================================================
+*/
+unsigned int hashUInt(unsigned int x) {
+    return mixBits(x * 0x9e3779b9u + 0x7f4a7c15u);
+}
@@ -0,0 +1,580 @@
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include <string>
+#include <string_view>
+#include <iostream>
+#include <utility>
+#include "DynamicArray.h"
+#include "TaskPool.h"
+using namespace std;
+
+const int HASH_INITIAL_CAPACITY = 16;        // must be a power of two
+const double HASH_DEFAULT_LOAD_FACTOR = 0.75;
+const int HASH_PARALLEL_CUTOFF = 16384;      // smaller bulk builds insert one by one
+
+// Hash primitives shared by every key type (HashMap.cpp)
+unsigned int hashBytes(const char* data, size_t length);
+unsigned int hashUInt(unsigned int x);
+
+// Per-key-type hashing. Add a specialization to index a new key type.
+// LookupType is what lookups accept: string keys are looked up through
+// string_view so that searching never builds a temporary string.
+template <class K> struct HashKey;
+
+template <> struct HashKey<string> {
+    typedef string_view LookupType;
+    static unsigned int hash(string_view key) { return hashBytes(key.data(), key.length()); }
+};
+
+template <> struct HashKey<int> {
+    typedef int LookupType;
+    static unsigned int hash(int key) { return hashUInt((unsigned int)key); }
+};
+
+template <> struct HashKey<unsigned int> {
+    typedef unsigned int LookupType;
+    static unsigned int hash(unsigned int key) { return hashUInt(key); }
+};
+
+/*
+============================================================
+Class       : HashMap
+Description : Open-addressing hash map from K to V with
+              linear probing over one flat slot array. A slot
+              is empty when its stored hash is 0 (hashes are
+              forced non-zero). Grows by doubling once the
+              configurable load factor would be exceeded, and
+              deletes with backward shifting (no tombstones).
+              build() fills an empty table from whole arrays
+              of keys, optionally on a thread pool: every
+              thread owns one range of slots and places the
+              keys whose home slot falls in it.
+              Templates must be defined in the header, so the
+              member functions live below the class.
+============================================================
+*/
+template <class K, class V>
+class HashMap {
+public:
+    typedef typename HashKey<K>::LookupType KeyArg;
+
+private:
+    struct Entry {
+        unsigned int hash;
+        K key;
+        V value;
+    };
+
+    // One slot range of a parallel build()
+    struct BuildJob {
+        HashMap* map;
+        const KeyArg* keys;
+        const V* values;
+        unsigned int* hashes;
+        int n;
+        int part;
+        int parts;
+        int placed;
+        DynamicArray<int> overflow;   // keys whose probe left the range
+    };
+
+    Entry* slots;
+    int capacity;          // number of slots (power of two)
+    int count;             // number of occupied slots
+    double maxLoadFactor;  // grow when count / capacity would exceed this
+
+    static unsigned int hashFunction(KeyArg key);
+    void grow();
+    void reserveEmpty(int expected);
+    static void placeEntry(Entry* target, int targetCapacity, unsigned int h,
+        K& key, const V& value);
+    int findSlot(KeyArg key) const;
+    static void hashTask(void* arg);
+    static void placeTask(void* arg);
+
+    // Not copyable: the map owns its slot array
+    HashMap(const HashMap&);
+    HashMap& operator=(const HashMap&);
+
+public:
+    HashMap(double loadFactor = HASH_DEFAULT_LOAD_FACTOR);
+    ~HashMap();
+    void insert(KeyArg key, const V& value);
+    void build(const KeyArg keys[], const V values[], int n, TaskPool* pool = nullptr);
+    V* find(KeyArg key);
+    V search(KeyArg key) const;  // V(-1) if absent; meant for index maps
+    bool contains(KeyArg key) const;
+    bool remove(KeyArg key);
+    void display();
+    void clear();
+    int size() const;
+    void setMaxLoadFactor(double loadFactor);
+};
+
+/*
+============================================================
+Function    : HashMap (Constructor)
+Description : Allocates the initial flat slot array and
+              marks every slot as empty.
+Input       : loadFactor - Maximum fill ratio before the
+              table doubles in size (double)
+Return      : None
+============================================================
+*/
+template <class K, class V>
+HashMap<K, V>::HashMap(double loadFactor) {
+    capacity = HASH_INITIAL_CAPACITY;
+    count = 0;
+    maxLoadFactor = HASH_DEFAULT_LOAD_FACTOR;
+    slots = new Entry[capacity];
+    for (int i = 0; i < capacity; i++) {
+        slots[i].hash = 0;
+    }
+    setMaxLoadFactor(loadFactor);
+}
+
+/*
+============================================================
+Function    : ~HashMap (Destructor)
+Description : Releases the slot array.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class K, class V>
+HashMap<K, V>::~HashMap() {
+    delete[] slots;
+}
+
+/*
+============================================================
+Function    : hashFunction
+Description : Hashes the key through its HashKey trait. The
+              result is never 0, since 0 marks an empty slot.
+Input       : key - Key to hash (KeyArg)
+Return      : Non-zero hash value (unsigned int)
+============================================================
+*/
+template <class K, class V>
+unsigned int HashMap<K, V>::hashFunction(KeyArg key) {
+    unsigned int h = HashKey<K>::hash(key);
+    return (h == 0) ? 1 : h;
+}
+
+/*
+============================================================
+Function    : placeEntry
+Description : Moves an entry into the first free slot at or
+              after its home position (linear probing). Used
+              by insert and when re-placing entries on grow.
+Input       : target - Slot array to place into
+              targetCapacity - Size of that array (int)
+              h - Pre-computed hash of the key (unsigned int)
+              key - Key to store, moved from (K&)
+              value - Value to store (V)
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::placeEntry(Entry* target, int targetCapacity, unsigned int h,
+    K& key, const V& value) {
+    int mask = targetCapacity - 1;
+    int pos = (int)(h & (unsigned int)mask);
+    while (target[pos].hash != 0) {
+        pos = (pos + 1) & mask;
+    }
+    target[pos].hash = h;
+    target[pos].key = move(key);
+    target[pos].value = value;
+}
+
+/*
+============================================================
+Function    : grow
+Description : Doubles the number of slots and moves every
+              occupied entry across using its stored hash, so
+              keys are never rehashed or copied.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::grow() {
+    int newCapacity = capacity * 2;
+    Entry* newSlots = new Entry[newCapacity];
+    for (int i = 0; i < newCapacity; i++) {
+        newSlots[i].hash = 0;
+    }
+    for (int i = 0; i < capacity; i++) {
+        if (slots[i].hash != 0) {
+            placeEntry(newSlots, newCapacity, slots[i].hash, slots[i].key, slots[i].value);
+        }
+    }
+    delete[] slots;
+    slots = newSlots;
+    capacity = newCapacity;
+}
+
+/*
+============================================================
+Function    : findSlot
+Description : Probes from the key's home slot until the key
+              or an empty slot is found.
+Input       : key - Key to look for (KeyArg)
+Return      : Slot position if found, -1 otherwise (int)
+============================================================
+*/
+template <class K, class V>
+int HashMap<K, V>::findSlot(KeyArg key) const {
+    unsigned int h = hashFunction(key);
+    int mask = capacity - 1;
+    int pos = (int)(h & (unsigned int)mask);
+    while (slots[pos].hash != 0) {
+        if (slots[pos].hash == h && slots[pos].key == key) {
+            return pos;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return -1;
+}
+
+/*
+============================================================
+Function    : insert
+Description : Inserts a key/value pair. If the key is already
+              present its value is replaced; otherwise the key
+              is copied into its slot. Grows the table first
+              when the load factor would be exceeded.
+Input       : key - Key to insert (KeyArg)
+              value - Value to associate (V)
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::insert(KeyArg key, const V& value) {
+    int pos = findSlot(key);
+    if (pos != -1) {
+        slots[pos].value = value;
+        return;
+    }
+
+    if (count + 1 > (int)(capacity * maxLoadFactor)) {
+        grow();
+    }
+    K ownedKey(key);
+    placeEntry(slots, capacity, hashFunction(key), ownedKey, value);
+    count++;
+}
+
+/*
+============================================================
+Function    : reserveEmpty
+Description : Empties the table and makes sure 'expected'
+              keys fit without growing.
+Input       : expected - Number of keys to come (int)
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::reserveEmpty(int expected) {
+    int newCapacity = capacity;
+    while (expected > (int)(newCapacity * maxLoadFactor)) {
+        newCapacity *= 2;
+    }
+    if (newCapacity == capacity) {
+        clear();
+        return;
+    }
+
+    delete[] slots;
+    slots = new Entry[newCapacity];
+    for (int i = 0; i < newCapacity; i++) {
+        slots[i].hash = 0;
+    }
+    capacity = newCapacity;
+    count = 0;
+}
+
+/*
+============================================================
+Function    : build
+Description : Replaces the contents with keys[i] -> values[i]
+              (a repeated key keeps its last value). Without a
+              pool, or for small inputs, the keys are simply
+              inserted. Otherwise the table is sized once, the
+              hashes are computed in parallel, and the slots
+              are split into one range per thread: each thread
+              places the keys whose home slot lies in its
+              range and never writes outside it. A key whose
+              probe would run past the end of its range is set
+              aside and inserted afterwards on this thread.
+              The result is a valid linear-probing table, the
+              same as inserting in any order.
+Input       : keys - Keys to store (const KeyArg[])
+              values - Value for each key (const V[])
+              n - Number of keys (int)
+              pool - Threads to use, or nullptr (TaskPool*)
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::build(const KeyArg keys[], const V values[], int n, TaskPool* pool) {
+    reserveEmpty(n);
+    if (pool == nullptr || pool->threadCount() < 2 || n < HASH_PARALLEL_CUTOFF) {
+        for (int i = 0; i < n; i++) {
+            insert(keys[i], values[i]);
+        }
+        return;
+    }
+
+    int parts = pool->threadCount();
+    unsigned int* hashes = new unsigned int[n];
+    BuildJob* jobs = new BuildJob[parts];
+    for (int p = 0; p < parts; p++) {
+        jobs[p].map = this;
+        jobs[p].keys = keys;
+        jobs[p].values = values;
+        jobs[p].hashes = hashes;
+        jobs[p].n = n;
+        jobs[p].part = p;
+        jobs[p].parts = parts;
+        jobs[p].placed = 0;
+    }
+
+    TaskGroup hashing;
+    for (int p = 0; p < parts; p++) pool->spawn(hashing, hashTask, &jobs[p]);
+    pool->wait(hashing);
+
+    TaskGroup placing;
+    for (int p = 0; p < parts; p++) pool->spawn(placing, placeTask, &jobs[p]);
+    pool->wait(placing);
+
+    // Leftovers in key order, so a repeated key still ends on its last value
+    for (int p = 0; p < parts; p++) count += jobs[p].placed;
+    for (int p = 0; p < parts; p++) {
+        const DynamicArray<int>& overflow = jobs[p].overflow;
+        for (int j = 0; j < overflow.size(); j++) {
+            insert(keys[overflow[j]], values[overflow[j]]);
+        }
+    }
+
+    delete[] jobs;
+    delete[] hashes;
+}
+
+/*
+============================================================
+Function    : hashTask / placeTask
+Description : The two parallel steps of build(). hashTask
+              hashes one contiguous share of the keys;
+              placeTask places every key homed in the job's
+              slot range, probing no further than the range.
+Input       : arg - The BuildJob (void*)
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::hashTask(void* arg) {
+    BuildJob* job = (BuildJob*)arg;
+    int first = (int)((long long)job->n * job->part / job->parts);
+    int last = (int)((long long)job->n * (job->part + 1) / job->parts);
+    for (int i = first; i < last; i++) {
+        job->hashes[i] = hashFunction(job->keys[i]);
+    }
+}
+
+template <class K, class V>
+void HashMap<K, V>::placeTask(void* arg) {
+    BuildJob* job = (BuildJob*)arg;
+    Entry* slots = job->map->slots;
+    int capacity = job->map->capacity;
+    int rangeStart = (int)((long long)capacity * job->part / job->parts);
+    int rangeEnd = (int)((long long)capacity * (job->part + 1) / job->parts);
+    unsigned int mask = (unsigned int)(capacity - 1);
+
+    for (int i = 0; i < job->n; i++) {
+        unsigned int h = job->hashes[i];
+        int pos = (int)(h & mask);
+        if (pos < rangeStart || pos >= rangeEnd) continue;
+
+        while (pos < rangeEnd && slots[pos].hash != 0 &&
+            !(slots[pos].hash == h && slots[pos].key == job->keys[i])) {
+            pos++;
+        }
+        if (pos == rangeEnd) {
+            job->overflow.add(i);
+        }
+        else if (slots[pos].hash != 0) {
+            slots[pos].value = job->values[i];   // repeated key
+        }
+        else {
+            slots[pos].hash = h;
+            slots[pos].key = K(job->keys[i]);
+            slots[pos].value = job->values[i];
+            job->placed++;
+        }
+    }
+}
+
+/*
+============================================================
+Function    : find
+Description : Looks up a key and gives access to its value.
+Input       : key - Key to look for (KeyArg)
+Return      : Pointer to the stored value, or nullptr if the
+              key is absent (V*)
+============================================================
+*/
+template <class K, class V>
+V* HashMap<K, V>::find(KeyArg key) {
+    int pos = findSlot(key);
+    if (pos == -1) return nullptr;
+    return &slots[pos].value;
+}
+
+/*
+============================================================
+Function    : search
+Description : Looks up a key in an index map (value is an
+              array position or handle).
+Input       : key - Key to look for (KeyArg)
+Return      : Stored value if found, V(-1) otherwise (V)
+============================================================
+*/
+template <class K, class V>
+V HashMap<K, V>::search(KeyArg key) const {
+    int pos = findSlot(key);
+    if (pos == -1) return (V)(-1);
+    return slots[pos].value;
+}
+
+/*
+============================================================
+Function    : contains
+Description : Checks whether a key is present.
+Input       : key - Key to look for (KeyArg)
+Return      : True if present, false otherwise (bool)
+============================================================
+*/
+template <class K, class V>
+bool HashMap<K, V>::contains(KeyArg key) const {
+    return findSlot(key) != -1;
+}
+
+/*
+============================================================
+Function    : remove
+Description : Removes a key from the table. Later entries of
+              the same probe run are shifted back into the
+              hole (backward-shift deletion), so no tombstones
+              are left behind and searches stay short.
+Input       : key - Key to remove (KeyArg)
+Return      : True if removed successfully, false if not
+              found (bool)
+============================================================
+*/
+template <class K, class V>
+bool HashMap<K, V>::remove(KeyArg key) {
+    int pos = findSlot(key);
+    if (pos == -1) {
+        return false;
+    }
+
+    int mask = capacity - 1;
+    int hole = pos;
+    int next = (hole + 1) & mask;
+    while (slots[next].hash != 0) {
+        int home = (int)(slots[next].hash & (unsigned int)mask);
+        // Move the entry back only if the hole lies on its probe path
+        // (cyclically between its home slot and its current slot).
+        bool movable = (hole <= next) ? (home <= hole || home > next)
+                                      : (home <= hole && home > next);
+        if (movable) {
+            slots[hole] = move(slots[next]);
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    slots[hole].hash = 0;
+    slots[hole].key = K();
+    count--;
+    return true;
+}
+
+/*
+============================================================
+Function    : display
+Description : Displays every occupied slot with its key and
+              value.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::display() {
+    cout << "=== Hash Table Contents ===" << endl;
+    for (int i = 0; i < capacity; i++) {
+        if (slots[i].hash != 0) {
+            cout << "Slot " << i << ": " << slots[i].key
+                << "(" << slots[i].value << ")" << endl;
+        }
+    }
+    cout << count << " entries in " << capacity << " slots" << endl;
+}
+
+/*
+============================================================
+Function    : clear
+Description : Empties the table while keeping the current
+              slot array, so a rebuild of the same size does
+              not reallocate.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::clear() {
+    for (int i = 0; i < capacity; i++) {
+        if (slots[i].hash != 0) {
+            slots[i].hash = 0;
+            slots[i].key = K();
+        }
+    }
+    count = 0;
+}
+
+/*
+============================================================
+Function    : size
+Description : Returns the number of keys stored.
+Input       : None
+Return      : Number of entries (int)
+============================================================
+*/
+template <class K, class V>
+int HashMap<K, V>::size() const {
+    return count;
+}
+
+/*
+============================================================
+Function    : setMaxLoadFactor
+Description : Sets the fill ratio at which the table grows.
+              Values outside [0.1, 0.95] are clamped so that
+              probing always terminates at an empty slot.
+Input       : loadFactor - New maximum load factor (double)
+Return      : None
+============================================================
+*/
+template <class K, class V>
+void HashMap<K, V>::setMaxLoadFactor(double loadFactor) {
+    if (loadFactor < 0.1) loadFactor = 0.1;
+    if (loadFactor > 0.95) loadFactor = 0.95;
+    maxLoadFactor = loadFactor;
+    while (count > (int)(capacity * maxLoadFactor)) {
+        grow();
+    }
+}
+
+#endif
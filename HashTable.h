@@ -2,29 +2,10 @@
 #define HASHTABLE_H
 
 #include <string>
+#include "HashMap.h"
 using namespace std;
 
-const int TABLE_SIZE = 101;
+// Game ID -> index in games[]
+typedef HashMap<string, int> HashTable;
 
-struct HashNode {
-    string gameID;
-    int arrayIndex;
-    HashNode* next;
-};
-
-class HashTable {
-private:
-    HashNode* table[TABLE_SIZE];
-    int hashFunction(string key);
-
-public:
-    HashTable();
-    ~HashTable();
-    void insert(string gameID, int arrayIndex);
-    int search(string gameID);
-    bool remove(string gameID);
-    void display();
-    void clear();  // Add this method
-};
-
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,132 @@
+#include "IdInterner.h"
+using namespace std;
+
+IdInterner gameIds;
+IdInterner memberIds;
+
+/*
+============================================================
+Function    : IdInterner (Constructor)
+Description : Creates an empty interner with no name blocks.
+Input       : None
+Return      : None
+============================================================
+*/
+IdInterner::IdInterner() {
+    blocks = nullptr;
+    blockCount = 0;
+    count = 0;
+}
+
+/*
+============================================================
+Function    : ~IdInterner (Destructor)
+Description : Releases every name block and the block table.
+Input       : None
+Return      : None
+============================================================
+*/
+IdInterner::~IdInterner() {
+    for (int i = 0; i < blockCount; i++) {
+        delete[] blocks[i];
+    }
+    delete[] blocks;
+}
+
+/*
+============================================================
+Function    : clear
+Description : Forgets every ID and releases the name blocks,
+              so the next intern() hands out handle 0 again.
+              Any handle taken before is meaningless after.
+Input       : None
+Return      : None
+============================================================
+*/
+void IdInterner::clear() {
+    for (int i = 0; i < blockCount; i++) {
+        delete[] blocks[i];
+    }
+    delete[] blocks;
+    blocks = nullptr;
+    blockCount = 0;
+    count = 0;
+    lookup.clear();
+}
+
+/*
+============================================================
+Function    : intern
+Description : Returns the handle for an ID, assigning the
+              next dense handle if the ID has not been seen.
+              Only a new block is allocated on growth; names
+              already stored never move.
+Input       : id - External ID (string_view)
+Return      : Handle for the ID (IdHandle)
+============================================================
+*/
+IdHandle IdInterner::intern(string_view id) {
+    IdHandle* existing = lookup.find(id);
+    if (existing != nullptr) {
+        return *existing;
+    }
+
+    if (count == blockCount * ID_BLOCK_SIZE) {
+        string** newBlocks = new string*[blockCount + 1];
+        for (int i = 0; i < blockCount; i++) {
+            newBlocks[i] = blocks[i];
+        }
+        newBlocks[blockCount] = new string[ID_BLOCK_SIZE];
+        delete[] blocks;
+        blocks = newBlocks;
+        blockCount++;
+    }
+
+    IdHandle handle = (IdHandle)count;
+    blocks[count / ID_BLOCK_SIZE][count % ID_BLOCK_SIZE] = id;
+    lookup.insert(id, handle);
+    count++;
+    return handle;
+}
+
+/*
+============================================================
+Function    : find
+Description : Looks up the handle of an ID without adding it.
+              Used for menu input, where an unknown ID must
+              not grow the handle space.
+Input       : id - External ID (string_view)
+Return      : Handle, or NO_ID if never interned (IdHandle)
+============================================================
+*/
+IdHandle IdInterner::find(string_view id) const {
+    return lookup.search(id);
+}
+
+/*
+============================================================
+Function    : name
+Description : Returns the external ID for a handle.
+Input       : handle - Handle to resolve (IdHandle)
+Return      : External ID, or "" for NO_ID (const string&)
+============================================================
+*/
+const string& IdInterner::name(IdHandle handle) const {
+    static const string emptyID = "";
+    if (handle == NO_ID || (int)handle >= count) {
+        return emptyID;
+    }
+    return blocks[handle / ID_BLOCK_SIZE][handle % ID_BLOCK_SIZE];
+}
+
+/*
+============================================================
+Function    : size
+Description : Returns the number of handles assigned.
+Input       : None
+Return      : Number of interned IDs (int)
+============================================================
+*/
+int IdInterner::size() const {
+    return count;
+}
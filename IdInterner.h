@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include "HashMap.h"
+using namespace std;
+
+// Dense integer handle for an external ID such as "G001" or "M001"
+typedef uint32_t IdHandle;
+const IdHandle NO_ID = 0xFFFFFFFFu;
+
+const int ID_BLOCK_SIZE = 256;   // names stored per block
+
+/*
+============================================================
+Class       : IdInterner
+Description : Maps external string IDs to dense handles
+              0, 1, 2... in first-seen order and back. IDs
+              are converted once at the boundary (CSV load,
+              menu input) so entity classes, indexes and
+              history scans work on plain integers. Names are
+              kept in fixed-size blocks, so a reference from
+              name() stays valid while more IDs are interned.
+============================================================
+*/
+class IdInterner {
+private:
+    HashMap<string, IdHandle> lookup;
+    string** blocks;    // blocks[h / ID_BLOCK_SIZE][h % ID_BLOCK_SIZE]
+    int blockCount;
+    int count;
+
+    // Not copyable: owns its blocks
+    IdInterner(const IdInterner&);
+    IdInterner& operator=(const IdInterner&);
+
+public:
+    IdInterner();
+    ~IdInterner();
+
+    IdHandle intern(string_view id);  // existing handle, or a new one
+    IdHandle find(string_view id) const;  // NO_ID if never interned
+    const string& name(IdHandle handle) const;
+    int size() const;
+    void clear();                     // forget every ID; handles restart at 0
+};
+
+// One handle space per entity kind
+extern IdInterner gameIds;
+extern IdInterner memberIds;
@@ -0,0 +1,740 @@
+#include "Journal.h"
+#include <fstream>
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+static const char JOURNAL_MAGIC[8] = { 'N', 'P', 'T', 'J', 'R', 'N', 'L', '1' };
+static const char SNAPSHOT_MAGIC[8] = { 'N', 'P', 'T', 'S', 'N', 'A', 'P', '1' };
+static const int JOURNAL_HEADER_BYTES = 12;   // magic + epoch
+static const int RECORD_HEADER_BYTES = 9;     // length + CRC + type
+static const int SNAPSHOT_HEADER_BYTES = 20;  // magic + epoch + length + CRC
+
+// ===================== LOW-LEVEL FILE ACCESS =====================
+// Thin wrappers so the rest of the journal is platform-neutral.
+
+#ifdef _WIN32
+static int openForAppend(const char* path) {
+    int fd = -1;
+    _sopen_s(&fd, path, _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+    return fd;
+}
+static bool writeAll(int fd, const char* data, int length) {
+    while (length > 0) {
+        int written = _write(fd, data, (unsigned int)length);
+        if (written <= 0) return false;
+        data += written;
+        length -= written;
+    }
+    return true;
+}
+static int openForReplace(const char* path) {
+    int fd = -1;
+    _sopen_s(&fd, path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+    return fd;
+}
+static bool syncFile(int fd) { return _commit(fd) == 0; }
+static bool truncateFile(int fd, long long length) { return _chsize_s(fd, length) == 0; }
+static void closeFile(int fd) { _close(fd); }
+static bool replaceFile(const char* from, const char* to) {
+    return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+#else
+static int openForAppend(const char* path) {
+    return ::open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+}
+static bool writeAll(int fd, const char* data, int length) {
+    while (length > 0) {
+        ssize_t written = ::write(fd, data, (size_t)length);
+        if (written <= 0) return false;
+        data += written;
+        length -= (int)written;
+    }
+    return true;
+}
+static int openForReplace(const char* path) {
+    return ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+}
+static bool syncFile(int fd) { return ::fsync(fd) == 0; }
+static bool truncateFile(int fd, long long length) { return ::ftruncate(fd, (off_t)length) == 0; }
+static void closeFile(int fd) { ::close(fd); }
+static bool replaceFile(const char* from, const char* to) {
+    return ::rename(from, to) == 0;
+}
+#endif
+
+// ===================== ENCODING HELPERS =====================
+static void appendUInt32(DynamicArray<char>& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.add((char)((value >> (8 * i)) & 0xFF));
+    }
+}
+
+static void storeUInt32(char* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = (char)((value >> (8 * i)) & 0xFF);
+    }
+}
+
+static uint32_t readUInt32(const char* data) {
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; i--) {
+        value = (value << 8) | (unsigned char)data[i];
+    }
+    return value;
+}
+
+// Whole file in one read; leaves 'contents' empty if missing
+static void readWholeFile(const char* path, DynamicArray<char>& contents) {
+    contents.clear();
+    ifstream in(path, ios::binary);
+    if (!in.is_open()) return;
+
+    in.seekg(0, ios::end);
+    long long size = (long long)in.tellg();
+    in.seekg(0, ios::beg);
+    if (size > 0) {
+        contents.resize((int)size);
+        in.read(contents.data(), size);
+        if (!in) contents.clear();
+    }
+}
+
+/*
+============================================================
+Function    : crc32
+Description : Standard CRC-32 (polynomial 0xEDB88320), table
+              driven. The table is built on first use.
+Input       : data - Bytes to checksum
+              length - Number of bytes (size_t)
+Return      : Checksum (uint32_t)
+============================================================
+*/
+uint32_t crc32(const char* data, size_t length) {
+    static uint32_t table[256];
+    static bool tableReady = false;
+    if (!tableReady) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            }
+            table[n] = c;
+        }
+        tableReady = true;
+    }
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; i++) {
+        crc = table[(crc ^ (unsigned char)data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+// ===================== JOURNAL ENTRY =====================
+
+/*
+============================================================
+Function    : JournalEntry (Constructor)
+Description : Starts an empty record of the given type.
+Input       : type - Kind of mutation (JournalEntryType)
+Return      : None
+============================================================
+*/
+JournalEntry::JournalEntry(JournalEntryType type) {
+    this->type = (unsigned char)type;
+}
+
+/*
+============================================================
+Function    : putInt
+Description : Appends a 32-bit integer field.
+Input       : value - Value to store (int)
+Return      : None
+============================================================
+*/
+void JournalEntry::putInt(int value) {
+    appendUInt32(payload, (uint32_t)value);
+}
+
+/*
+============================================================
+Function    : putString
+Description : Appends a string field as its byte length
+              followed by the bytes.
+Input       : text - Text to store (string_view)
+Return      : None
+============================================================
+*/
+void JournalEntry::putString(string_view text) {
+    appendUInt32(payload, (uint32_t)text.length());
+    for (size_t i = 0; i < text.length(); i++) {
+        payload.add(text[i]);
+    }
+}
+
+unsigned char JournalEntry::getType() const { return type; }
+const DynamicArray<char>& JournalEntry::getPayload() const { return payload; }
+
+// ===================== JOURNAL READER =====================
+
+/*
+============================================================
+Function    : JournalReader (Constructor)
+Description : Wraps the payload of one record for reading.
+Input       : data - First payload byte
+              length - Payload size in bytes (int)
+Return      : None
+============================================================
+*/
+JournalReader::JournalReader(const char* data, int length) {
+    this->data = data;
+    this->length = length;
+    pos = 0;
+}
+
+/*
+============================================================
+Function    : getInt
+Description : Reads the next 32-bit integer field.
+Input       : value - Receives the value (int&)
+Return      : False if the payload is too short (bool)
+============================================================
+*/
+bool JournalReader::getInt(int& value) {
+    if (length - pos < 4) return false;
+    value = (int)readUInt32(data + pos);
+    pos += 4;
+    return true;
+}
+
+/*
+============================================================
+Function    : getString
+Description : Reads the next length-prefixed string field.
+Input       : text - Receives the string (string&)
+Return      : False if the payload is too short (bool)
+============================================================
+*/
+bool JournalReader::getString(string& text) {
+    if (length - pos < 4) return false;
+    uint32_t size = readUInt32(data + pos);
+    if (size > (uint32_t)(length - pos - 4)) return false;
+    text.assign(data + pos + 4, size);
+    pos += 4 + (int)size;
+    return true;
+}
+
+// ===================== JOURNAL =====================
+
+/*
+============================================================
+Function    : Journal (Constructor)
+Description : Creates a closed journal; call open() to use it.
+Input       : None
+Return      : None
+============================================================
+*/
+Journal::Journal() : failedBatches(0) {
+    fd = -1;
+    syncIntervalMs = JOURNAL_SYNC_INTERVAL_MS;
+    epoch = 0;
+    recordCount = 0;
+    flusherRunning = false;
+    stopping = false;
+}
+
+/*
+============================================================
+Function    : ~Journal (Destructor)
+Description : Syncs pending records and closes the file.
+Input       : None
+Return      : None
+============================================================
+*/
+Journal::~Journal() {
+    close();
+}
+
+/*
+============================================================
+Function    : open
+Description : Replays an existing journal and opens it for
+              appending (creating it if missing). Records are
+              replayed in order until the first one that is
+              cut short or fails its checksum; everything from
+              there on is the unsynced tail of a crash and is
+              truncated away. A journal whose epoch is already
+              covered by the loaded snapshot is not replayed
+              but emptied and moved to the next epoch. Then
+              the group-commit thread is started.
+Input       : path - Journal file (const char*)
+              intervalMs - Group-commit window in ms, 0 to
+              sync every append (int)
+              coveredEpoch - Epoch of the loaded snapshot, 0
+              if the state came from games.csv (uint32_t)
+              replay - Called once per intact record
+              (JournalReplayFunction)
+              context - Passed through to replay (void*)
+Return      : Number of records replayed, or -1 if the file
+              could not be used (int)
+============================================================
+*/
+int Journal::open(const char* path, int intervalMs, uint32_t coveredEpoch,
+    JournalReplayFunction replay, void* context) {
+    close();
+    syncIntervalMs = (intervalMs < 0) ? 0 : intervalMs;
+
+    // Read whatever is already on disk
+    DynamicArray<char> contents;
+    readWholeFile(path, contents);
+
+    int fileSize = contents.size();
+    if (fileSize > 0 && (fileSize < (int)sizeof(JOURNAL_MAGIC) ||
+        memcmp(contents.data(), JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0)) {
+        cout << "ERROR: " << path << " is not a journal file; changes will not be saved." << endl;
+        return -1;
+    }
+
+    // A missing or torn header counts as an empty, covered journal
+    bool covered = true;
+    if (fileSize >= JOURNAL_HEADER_BYTES) {
+        uint32_t fileEpoch = readUInt32(contents.data() + sizeof(JOURNAL_MAGIC));
+        covered = (fileEpoch <= coveredEpoch);
+        if (!covered) {
+            epoch = fileEpoch;
+            if (fileEpoch > coveredEpoch + 1) {
+                cout << "WARNING: The snapshot for " << path
+                    << " is missing; some earlier changes may be lost." << endl;
+            }
+        }
+    }
+
+    int replayed = 0;
+    int validEnd = JOURNAL_HEADER_BYTES;
+    while (!covered && fileSize - validEnd >= RECORD_HEADER_BYTES) {
+        const char* record = contents.data() + validEnd;
+        uint32_t payloadLength = readUInt32(record);
+        uint32_t checksum = readUInt32(record + 4);
+        if (payloadLength > (uint32_t)JOURNAL_MAX_ENTRY_BYTES ||
+            payloadLength > (uint32_t)(fileSize - validEnd - RECORD_HEADER_BYTES)) {
+            break;
+        }
+        // The checksum covers the type byte and the payload
+        if (crc32(record + 8, payloadLength + 1) != checksum) break;
+
+        JournalReader fields(record + RECORD_HEADER_BYTES, (int)payloadLength);
+        replay((unsigned char)record[8], fields, context);
+        replayed++;
+        validEnd += RECORD_HEADER_BYTES + (int)payloadLength;
+    }
+
+    fd = openForAppend(path);
+    if (fd < 0) {
+        cout << "ERROR: Cannot open " << path << " for writing; changes will not be saved." << endl;
+        return -1;
+    }
+
+    recordCount = replayed;
+    if (covered) {
+        writeHeader(coveredEpoch + 1);
+    }
+    else if (validEnd < fileSize) {
+        cout << "WARNING: Discarded " << (fileSize - validEnd)
+            << " bytes of incomplete journal data." << endl;
+        truncateFile(fd, validEnd);
+        syncFile(fd);
+    }
+
+    stopping = false;
+    if (syncIntervalMs > 0) {
+        flusher = thread(&Journal::flusherLoop, this);
+        flusherRunning = true;
+    }
+    return replayed;
+}
+
+/*
+============================================================
+Function    : isOpen
+Description : Checks whether appends are being saved.
+Input       : None
+Return      : True if the journal file is open (bool)
+============================================================
+*/
+bool Journal::isOpen() const {
+    return fd >= 0;
+}
+
+/*
+============================================================
+Function    : getEpoch
+Description : Returns the epoch new records are written in.
+              A snapshot saved now must be tagged with it.
+Input       : None
+Return      : Current epoch (uint32_t)
+============================================================
+*/
+uint32_t Journal::getEpoch() const {
+    return epoch;
+}
+
+/*
+============================================================
+Function    : size
+Description : Counts the records of the current epoch, i.e.
+              the changes a restart would replay.
+Input       : None
+Return      : Number of records (int)
+============================================================
+*/
+int Journal::size() const {
+    return recordCount;
+}
+
+/*
+============================================================
+Function    : writeHeader
+Description : Empties the file and starts it again with the
+              magic and a new epoch, then syncs. The caller
+              holds fileLock or owns the journal exclusively.
+Input       : newEpoch - Epoch to start (uint32_t)
+Return      : False if the file could not be rewritten (bool)
+============================================================
+*/
+bool Journal::writeHeader(uint32_t newEpoch) {
+    char header[JOURNAL_HEADER_BYTES];
+    memcpy(header, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    storeUInt32(header + sizeof(JOURNAL_MAGIC), newEpoch);
+
+    epoch = newEpoch;
+    recordCount = 0;
+    return truncateFile(fd, 0) && writeAll(fd, header, JOURNAL_HEADER_BYTES) && syncFile(fd);
+}
+
+/*
+============================================================
+Function    : append
+Description : Adds one record to the pending batch. With a
+              sync interval the call returns at once and the
+              flusher thread makes the batch durable; without
+              one the record is written and synced here.
+              Reports any earlier batch that failed to write.
+Input       : entry - Record to log (const JournalEntry&)
+Return      : None
+============================================================
+*/
+void Journal::append(const JournalEntry& entry) {
+    if (fd < 0) return;
+    reportFailures();
+
+    const DynamicArray<char>& payload = entry.getPayload();
+    bool wakeNow;
+    {
+        lock_guard<mutex> guard(pendingLock);
+        bool wasEmpty = pending.isEmpty();
+
+        int start = pending.size();
+        pending.resize(start + RECORD_HEADER_BYTES + payload.size());
+        char* out = pending.data() + start;
+        out[8] = (char)entry.getType();
+        if (payload.size() > 0) {
+            memcpy(out + RECORD_HEADER_BYTES, payload.data(), payload.size());
+        }
+        uint32_t length = (uint32_t)payload.size();
+        storeUInt32(out, length);
+        storeUInt32(out + 4, crc32(out + 8, length + 1));
+        recordCount++;
+
+        wakeNow = wasEmpty || pending.size() >= JOURNAL_MAX_BATCH_BYTES;
+    }
+
+    if (!flusherRunning) {
+        writeBatch();
+        reportFailures();
+    }
+    else if (wakeNow) {
+        wakeFlusher.notify_one();
+    }
+}
+
+/*
+============================================================
+Function    : writeBatch
+Description : Takes every pending record, writes them with one
+              write call and makes them durable with one sync.
+              Runs on the flusher thread too, so a failure is
+              only counted here; reportFailures prints it.
+Input       : None
+Return      : None
+============================================================
+*/
+void Journal::writeBatch() {
+    lock_guard<mutex> fileGuard(fileLock);
+    {
+        lock_guard<mutex> guard(pendingLock);
+        writing.swap(pending);
+    }
+    if (writing.isEmpty() || fd < 0) return;
+
+    if (!writeAll(fd, writing.data(), writing.size()) || !syncFile(fd)) {
+        failedBatches.fetch_add(1);
+    }
+    writing.clear();
+}
+
+/*
+============================================================
+Function    : reportFailures
+Description : Prints how many batches failed to save since the
+              last report. Only called from append, flush and
+              close, i.e. on the thread using the journal.
+Input       : None
+Return      : None
+============================================================
+*/
+void Journal::reportFailures() {
+    int failed = failedBatches.exchange(0);
+    if (failed > 0) {
+        cout << "ERROR: Failed to save changes to the journal (" << failed
+            << " batch(es) lost)." << endl;
+    }
+}
+
+/*
+============================================================
+Function    : flusherLoop
+Description : Body of the group-commit thread. Sleeps until a
+              record is pending, waits out the sync interval
+              (or until the batch is large) so the rest of a
+              burst can join, then writes and syncs the batch.
+Input       : None
+Return      : None
+============================================================
+*/
+void Journal::flusherLoop() {
+    unique_lock<mutex> guard(pendingLock);
+    while (true) {
+        wakeFlusher.wait(guard, [this] { return stopping || !pending.isEmpty(); });
+        if (stopping) break;
+
+        wakeFlusher.wait_for(guard, chrono::milliseconds(syncIntervalMs), [this] {
+            return stopping || pending.size() >= JOURNAL_MAX_BATCH_BYTES;
+        });
+
+        guard.unlock();
+        writeBatch();
+        guard.lock();
+    }
+}
+
+/*
+============================================================
+Function    : flush
+Description : Writes and syncs every pending record now and
+              reports any batch that failed.
+Input       : None
+Return      : None
+============================================================
+*/
+void Journal::flush() {
+    writeBatch();
+    reportFailures();
+}
+
+/*
+============================================================
+Function    : restart
+Description : Log compaction. Call right after a snapshot of
+              the current state was saved with getEpoch():
+              every record so far, written or still pending,
+              is in that snapshot, so the file is cut back to
+              its header and moves on to the next epoch.
+Input       : None
+Return      : False if the journal is closed or could not be
+              rewritten (bool)
+============================================================
+*/
+bool Journal::restart() {
+    if (fd < 0) return false;
+
+    lock_guard<mutex> fileGuard(fileLock);
+    lock_guard<mutex> guard(pendingLock);
+    pending.clear();
+    return writeHeader(epoch + 1);
+}
+
+/*
+============================================================
+Function    : close
+Description : Stops the group-commit thread, syncs what is
+              still pending and closes the file.
+Input       : None
+Return      : None
+============================================================
+*/
+void Journal::close() {
+    if (flusherRunning) {
+        {
+            lock_guard<mutex> guard(pendingLock);
+            stopping = true;
+        }
+        wakeFlusher.notify_one();
+        flusher.join();
+        flusherRunning = false;
+    }
+    if (fd >= 0) {
+        writeBatch();
+        reportFailures();
+        closeFile(fd);
+        fd = -1;
+    }
+}
+
+// ===================== SNAPSHOT WRITER =====================
+
+/*
+============================================================
+Function    : putInt
+Description : Appends a 32-bit integer field to the body.
+Input       : value - Value to store (int)
+Return      : None
+============================================================
+*/
+void SnapshotWriter::putInt(int value) {
+    appendUInt32(body, (uint32_t)value);
+}
+
+/*
+============================================================
+Function    : putString
+Description : Appends a length-prefixed string field.
+Input       : text - Text to store (string_view)
+Return      : None
+============================================================
+*/
+void SnapshotWriter::putString(string_view text) {
+    appendUInt32(body, (uint32_t)text.length());
+    int start = body.size();
+    body.resize(start + (int)text.length());
+    if (!text.empty()) memcpy(body.data() + start, text.data(), text.length());
+}
+
+/*
+============================================================
+Function    : save
+Description : Writes header and body to "<path>.tmp" with a
+              single write, syncs it and renames it over the
+              old snapshot.
+Input       : path - Snapshot file (const char*)
+              epoch - Journal epoch the state covers (uint32_t)
+Return      : True once the new snapshot is in place (bool)
+============================================================
+*/
+bool SnapshotWriter::save(const char* path, uint32_t epoch) {
+    DynamicArray<char> file;
+    file.resize(SNAPSHOT_HEADER_BYTES + body.size());
+    char* out = file.data();
+    memcpy(out, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    storeUInt32(out + 8, epoch);
+    storeUInt32(out + 12, (uint32_t)body.size());
+    storeUInt32(out + 16, crc32(body.data(), body.size()));
+    if (body.size() > 0) memcpy(out + SNAPSHOT_HEADER_BYTES, body.data(), body.size());
+
+    string tempPath = string(path) + ".tmp";
+    int fd = openForReplace(tempPath.c_str());
+    if (fd < 0) return false;
+    bool written = writeAll(fd, file.data(), file.size()) && syncFile(fd);
+    closeFile(fd);
+
+    if (!written || !replaceFile(tempPath.c_str(), path)) {
+        remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// ===================== SNAPSHOT =====================
+
+/*
+============================================================
+Function    : Snapshot (Constructor)
+Description : Creates an empty snapshot; call load() to use it.
+Input       : None
+Return      : None
+============================================================
+*/
+Snapshot::Snapshot() {
+    epoch = 0;
+}
+
+/*
+============================================================
+Function    : load
+Description : Reads a snapshot file in one go and validates
+              its magic, length and checksum.
+Input       : path - Snapshot file (const char*)
+Return      : False if the file is missing or damaged (bool)
+============================================================
+*/
+bool Snapshot::load(const char* path) {
+    readWholeFile(path, contents);
+    if (contents.isEmpty()) return false;
+
+    const char* data = contents.data();
+    int fileSize = contents.size();
+    if (fileSize < SNAPSHOT_HEADER_BYTES ||
+        memcmp(data, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 ||
+        readUInt32(data + 12) != (uint32_t)(fileSize - SNAPSHOT_HEADER_BYTES) ||
+        readUInt32(data + 16) != crc32(data + SNAPSHOT_HEADER_BYTES, fileSize - SNAPSHOT_HEADER_BYTES)) {
+        cout << "WARNING: " << path << " is damaged and was ignored." << endl;
+        contents.clear();
+        return false;
+    }
+
+    epoch = readUInt32(data + 8);
+    return true;
+}
+
+/*
+============================================================
+Function    : getEpoch
+Description : Returns the journal epoch the snapshot covers.
+Input       : None
+Return      : Epoch (uint32_t)
+============================================================
+*/
+uint32_t Snapshot::getEpoch() const {
+    return epoch;
+}
+
+/*
+============================================================
+Function    : fields
+Description : Returns a reader positioned at the first field
+              of the body. Only valid after a successful load.
+Input       : None
+Return      : Field reader (JournalReader)
+============================================================
+*/
+JournalReader Snapshot::fields() const {
+    return JournalReader(contents.data() + SNAPSHOT_HEADER_BYTES,
+        contents.size() - SNAPSHOT_HEADER_BYTES);
+}
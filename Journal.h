@@ -0,0 +1,189 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include "DynamicArray.h"
+using namespace std;
+
+const int JOURNAL_SYNC_INTERVAL_MS = 20;        // group-commit window; 0 = sync every entry
+const int JOURNAL_MAX_BATCH_BYTES = 64 * 1024;  // sync early once this much is pending
+const int JOURNAL_MAX_ENTRY_BYTES = 1 << 20;    // larger lengths mean a corrupt record
+const int SNAPSHOT_INTERVAL_CHANGES = 500;      // journal records before an automatic snapshot
+
+// Mutation kinds stored in the journal (never renumber)
+enum JournalEntryType {
+    JOURNAL_BORROW = 1,       // memberID, gameID, date
+    JOURNAL_RETURN = 2,       // gameID, date
+    JOURNAL_REVIEW = 3,       // memberID, gameID, rating, text, date
+    JOURNAL_PLAY = 4,         // gameID, n, n x playerID, winnerID, recordedByID, timestamp
+    JOURNAL_ADD_GAME = 5,     // gameID, title, minP, maxP, minT, maxT, year
+    JOURNAL_REMOVE_GAME = 6,  // gameID
+    JOURNAL_ADD_MEMBER = 7,   // memberID, name, email
+    JOURNAL_UPDATE_GAME = 8   // gameID, title, minP, maxP, minT, maxT, year
+};
+
+// CRC-32 (IEEE) used to checksum every record
+uint32_t crc32(const char* data, size_t length);
+
+/*
+============================================================
+Class       : JournalEntry
+Description : Builds the payload of one journal record: a
+              type byte followed by little-endian 32-bit ints
+              and length-prefixed strings, in the field order
+              listed for the type.
+============================================================
+*/
+class JournalEntry {
+private:
+    unsigned char type;
+    DynamicArray<char> payload;
+
+public:
+    JournalEntry(JournalEntryType type);
+
+    void putInt(int value);
+    void putString(string_view text);
+
+    unsigned char getType() const;
+    const DynamicArray<char>& getPayload() const;
+};
+
+/*
+============================================================
+Class       : JournalReader
+Description : Reads the fields of one record back during
+              replay. Every read is bounds-checked and returns
+              false once the payload runs out.
+============================================================
+*/
+class JournalReader {
+private:
+    const char* data;
+    int length;
+    int pos;
+
+public:
+    JournalReader(const char* data, int length);
+
+    bool getInt(int& value);
+    bool getString(string& text);
+};
+
+// Called for every intact record while a journal is replayed
+typedef void (*JournalReplayFunction)(unsigned char type, JournalReader& fields, void* context);
+
+/*
+============================================================
+Class       : Journal
+Description : Append-only write-ahead log of every mutation.
+              On disk: an 8-byte magic and a 32-bit epoch,
+              then records of [payload length][CRC-32][type]
+              [payload]. The epoch ties the log to snapshots:
+              a snapshot taken during epoch E contains every
+              record of E, after which restart() empties the
+              file and moves it to epoch E + 1.
+              open() replays the intact prefix through a
+              callback (unless a loaded snapshot already
+              covers the file's epoch) and cuts off a torn or
+              corrupt tail left by a crash. Appends go to an
+              in-memory batch that a background thread writes
+              and syncs (fsync / _commit) once per sync
+              interval, so a burst of transactions shares one
+              sync. With an interval of 0 every append is
+              synced before it returns. close() syncs whatever
+              is pending. A failed write is only counted where
+              it happens (possibly on the flusher thread); the
+              next append / flush / close reports it on the
+              calling thread, so it never breaks into a menu.
+============================================================
+*/
+class Journal {
+private:
+    int fd;
+    int syncIntervalMs;
+    uint32_t epoch;
+    int recordCount;              // records in the current epoch
+
+    DynamicArray<char> pending;   // encoded records not yet written
+    DynamicArray<char> writing;   // batch being written by the flusher
+    mutex pendingLock;
+    mutex fileLock;               // serialises writes + syncs
+    condition_variable wakeFlusher;
+    thread flusher;
+    bool flusherRunning;
+    bool stopping;
+    atomic<int> failedBatches;    // write / sync failures not yet reported
+
+    void writeBatch();
+    void reportFailures();
+    void flusherLoop();
+    bool writeHeader(uint32_t newEpoch);
+
+    // Not copyable: owns a file and a thread
+    Journal(const Journal&);
+    Journal& operator=(const Journal&);
+
+public:
+    Journal();
+    ~Journal();
+
+    int open(const char* path, int intervalMs, uint32_t coveredEpoch,
+        JournalReplayFunction replay, void* context);
+    bool isOpen() const;
+    uint32_t getEpoch() const;
+    int size() const;
+    void append(const JournalEntry& entry);
+    void flush();
+    bool restart();
+    void close();
+};
+
+/*
+============================================================
+Class       : SnapshotWriter
+Description : Collects a full copy of the program state,
+              encoded with the same int / string fields as
+              journal records, and saves it atomically: the
+              file is written and synced under a temporary
+              name, then renamed over the old snapshot, so a
+              crash leaves either the old or the new one.
+              On disk: an 8-byte magic, the journal epoch the
+              snapshot covers, the body length and a CRC-32
+              of the body, then the body.
+============================================================
+*/
+class SnapshotWriter {
+private:
+    DynamicArray<char> body;
+
+public:
+    void putInt(int value);
+    void putString(string_view text);
+    bool save(const char* path, uint32_t epoch);
+};
+
+/*
+============================================================
+Class       : Snapshot
+Description : A snapshot file read back with one bulk read
+              and checked against its CRC before any field is
+              decoded. fields() then walks the body.
+============================================================
+*/
+class Snapshot {
+private:
+    DynamicArray<char> contents;
+    uint32_t epoch;
+
+public:
+    Snapshot();
+
+    bool load(const char* path);
+    uint32_t getEpoch() const;
+    JournalReader fields() const;
+};
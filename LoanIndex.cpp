@@ -0,0 +1,99 @@
+#include "LoanIndex.h"
+using namespace std;
+
+/*
+============================================================
+Function    : open
+Description : Records that a game has just been borrowed and
+              which records[] slot holds the loan. The per-game
+              table grows to cover new handles.
+Input       : gameKey - Borrowed game (IdHandle)
+              recordSlot - Index of its BorrowRecord (int)
+Return      : None
+============================================================
+*/
+void LoanIndex::open(IdHandle gameKey, int recordSlot) {
+    if (gameKey == NO_ID) return;
+
+    if (gameKey >= (IdHandle)perGame.size()) {
+        int oldSize = perGame.size();
+        perGame.resize((int)gameKey + 1);
+        for (int i = oldSize; i < perGame.size(); i++) {
+            perGame[i].record = -1;
+            perGame[i].listSlot = -1;
+        }
+    }
+
+    GameLoan& loan = perGame[gameKey];
+    if (loan.listSlot == -1) {
+        loan.listSlot = openGames.size();
+        openGames.add(gameKey);
+    }
+    loan.record = recordSlot;
+}
+
+/*
+============================================================
+Function    : close
+Description : Ends the open loan of a game and hands back its
+              record slot so the caller can mark it returned.
+Input       : gameKey - Returned game (IdHandle)
+Return      : Record slot of the loan, -1 if the game was not
+              on loan (int)
+============================================================
+*/
+int LoanIndex::close(IdHandle gameKey) {
+    if (gameKey == NO_ID || gameKey >= (IdHandle)perGame.size()) return -1;
+
+    GameLoan& loan = perGame[gameKey];
+    int record = loan.record;
+    if (loan.listSlot != -1) {
+        // Fill the hole with the last open loan
+        int last = openGames.size() - 1;
+        IdHandle moved = openGames[last];
+        openGames[loan.listSlot] = moved;
+        perGame[moved].listSlot = loan.listSlot;
+        openGames.removeAt(last);
+    }
+    loan.record = -1;
+    loan.listSlot = -1;
+    return record;
+}
+
+/*
+============================================================
+Function    : findOpen
+Description : Looks up the open loan of a game.
+Input       : gameKey - Game handle (IdHandle)
+Return      : Record slot, -1 if not on loan (int)
+============================================================
+*/
+int LoanIndex::findOpen(IdHandle gameKey) const {
+    if (gameKey == NO_ID || gameKey >= (IdHandle)perGame.size()) return -1;
+    return perGame[gameKey].record;
+}
+
+/*
+============================================================
+Function    : openCount
+Description : Returns how many games are on loan right now.
+Input       : None
+Return      : Number of open loans (int)
+============================================================
+*/
+int LoanIndex::openCount() const {
+    return openGames.size();
+}
+
+/*
+============================================================
+Function    : openGameAt
+Description : Returns one of the games on loan. The order is
+              not meaningful and changes as loans close.
+Input       : i - Position, 0..openCount()-1 (int)
+Return      : Game handle (IdHandle)
+============================================================
+*/
+IdHandle LoanIndex::openGameAt(int i) const {
+    return openGames[i];
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "DynamicArray.h"
+#include "IdInterner.h"
+
+/*
+============================================================
+Class       : LoanIndex
+Description : Tracks the loans that are currently open. For
+              every game handle it stores the records[] slot
+              of its open BorrowRecord (-1 when the game is on
+              the shelf), so a return finds its record in O(1)
+              instead of scanning the borrow history. The open
+              loans are also kept in a dense list, removed by
+              swapping the last entry into the hole, so they
+              can be listed without scanning the catalog.
+============================================================
+*/
+class LoanIndex {
+private:
+    struct GameLoan {
+        int record;      // open record slot, -1 if not on loan
+        int listSlot;    // position in openGames, -1 if not on loan
+    };
+
+    DynamicArray<GameLoan> perGame;      // indexed by game handle
+    DynamicArray<IdHandle> openGames;    // games currently on loan
+
+public:
+    void open(IdHandle gameKey, int recordSlot);
+    int close(IdHandle gameKey);
+
+    int findOpen(IdHandle gameKey) const;
+    int openCount() const;
+    IdHandle openGameAt(int i) const;
+};
@@ -0,0 +1,165 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+// Stands in for the data of an open but empty file
+static const char EMPTY_FILE[1] = { 0 };
+
+/*
+============================================================
+Function    : MappedFile (Constructor)
+Description : Creates a closed mapping; call open() to use it.
+Input       : None
+Return      : None
+============================================================
+*/
+MappedFile::MappedFile() {
+    view = nullptr;
+    length = 0;
+}
+
+/*
+============================================================
+Function    : ~MappedFile (Destructor)
+Description : Unmaps the file if it is still open.
+Input       : None
+Return      : None
+============================================================
+*/
+MappedFile::~MappedFile() {
+    close();
+}
+
+/*
+============================================================
+Function    : open
+Description : Maps the whole file read-only. The file and
+              mapping handles are released straight away; the
+              view stays valid until close().
+Input       : path - File to map (const char*)
+Return      : False if the file cannot be opened or mapped
+              (bool)
+============================================================
+*/
+bool MappedFile::open(const char* path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    if (fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        view = EMPTY_FILE;
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL) return false;
+
+    void* mapped = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (mapped == NULL) return false;
+
+    view = (const char*)mapped;
+    length = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    if (info.st_size == 0) {
+        ::close(fd);
+        view = EMPTY_FILE;
+        return true;
+    }
+
+    void* mapped = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) return false;
+    madvise(mapped, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+    view = (const char*)mapped;
+    length = (size_t)info.st_size;
+#endif
+    return true;
+}
+
+/*
+============================================================
+Function    : close
+Description : Unmaps the file. Views handed out earlier become
+              invalid.
+Input       : None
+Return      : None
+============================================================
+*/
+void MappedFile::close() {
+    if (view != nullptr && view != EMPTY_FILE) {
+#ifdef _WIN32
+        UnmapViewOfFile(view);
+#else
+        munmap((void*)view, length);
+#endif
+    }
+    view = nullptr;
+    length = 0;
+}
+
+/*
+============================================================
+Function    : isOpen
+Description : Checks whether a file is mapped.
+Input       : None
+Return      : True after a successful open() (bool)
+============================================================
+*/
+bool MappedFile::isOpen() const {
+    return view != nullptr;
+}
+
+/*
+============================================================
+Function    : data
+Description : Returns the first byte of the file.
+Input       : None
+Return      : Start of the mapped bytes (const char*)
+============================================================
+*/
+const char* MappedFile::data() const {
+    return view;
+}
+
+/*
+============================================================
+Function    : size
+Description : Returns the file length in bytes.
+Input       : None
+Return      : Length (size_t)
+============================================================
+*/
+size_t MappedFile::size() const {
+    return length;
+}
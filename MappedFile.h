@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+using namespace std;
+
+/*
+============================================================
+Class       : MappedFile
+Description : Read-only memory mapping of a whole file
+              (mmap / MapViewOfFile). The bytes are read
+              straight out of the page cache, so parsing can
+              hand out views into the file without copying
+              it into a buffer first. An empty file opens
+              with size 0 and no data.
+============================================================
+*/
+class MappedFile {
+private:
+    const char* view;
+    size_t length;
+
+    // Not copyable: owns the mapping
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    bool open(const char* path);
+    void close();
+
+    bool isOpen() const;
+    const char* data() const;
+    size_t size() const;
+};
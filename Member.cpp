@@ -11,7 +11,7 @@ Return      : None
 ============================================================
 */
 Member::Member() {
-    memberID = "";
+    memberKey = NO_ID;
     name = "";
     email = "";
 }
@@ -20,7 +20,8 @@ Member::Member() {
 ============================================================
 Function    : Member (Parameterized Constructor)
 Description : Initializes a Member object with the provided
-              member details.
+              member details. The member ID is interned into
+              a dense handle.
 Input       : id - Member ID (string)
               n - Member name (string)
               e - Member email (string)
@@ -28,7 +29,7 @@ Return      : None
 ============================================================
 */
 Member::Member(string id, string n, string e) {
-    memberID = id;
+    memberKey = memberIds.intern(id);
     name = n;
     email = e;
 }
@@ -38,61 +39,65 @@ Member::Member(string id, string n, string e) {
 Function    : getMemberID
 Description : Returns the member ID.
 Input       : None
-Return      : Member ID (string)
+Return      : Member ID (const string&)
 ============================================================
 */
-string Member::getMemberID() { return memberID; }
+const string& Member::getMemberID() const { return memberIds.name(memberKey); }
+
+/*
+============================================================
+Function    : getMemberKey
+Description : Returns the interned handle of the member ID.
+Input       : None
+Return      : Member handle (IdHandle)
+============================================================
+*/
+IdHandle Member::getMemberKey() const { return memberKey; }
 
 /*
 ============================================================
 Function    : getName
 Description : Returns the member's name.
 Input       : None
-Return      : Member name (string)
+Return      : Member name (const string&)
 ============================================================
 */
-string Member::getName() { return name; }
+const string& Member::getName() const { return name; }
 
 /*
 ============================================================
 Function    : getEmail
 Description : Returns the member's email address.
 Input       : None
-Return      : Email address (string)
+Return      : Email address (const string&)
 ============================================================
 */
-string Member::getEmail() { return email; }
+const string& Member::getEmail() const { return email; }
 
 /*
 ============================================================
 Function    : addBorrowedGame
-Description : Adds a game ID to the member's list of
-              currently borrowed games.
-Input       : gameID - Game identifier (string)
+Description : Adds a game to the member's set of currently
+              borrowed games.
+Input       : gameKey - Interned game ID (IdHandle)
 Return      : None
 ============================================================
 */
-void Member::addBorrowedGame(string gameID) {
-    borrowedGames.add(gameID);
+void Member::addBorrowedGame(IdHandle gameKey) {
+    borrowedGames.add(gameKey);
 }
 
 /*
 ============================================================
 Function    : removeBorrowedGame
-Description : Removes a game ID from the member's list of
-              currently borrowed games by searching for it
-              and deleting the matching entry.
-Input       : gameID - Game identifier to remove (string)
+Description : Removes a game from the member's set of
+              currently borrowed games.
+Input       : gameKey - Interned game ID (IdHandle)
 Return      : None
 ============================================================
 */
-void Member::removeBorrowedGame(string gameID) {
-    for (int i = 0; i < borrowedGames.getLength(); i++) {
-        if (borrowedGames.get(i) == gameID) {
-            borrowedGames.remove(i);
-            break;
-        }
-    }
+void Member::removeBorrowedGame(IdHandle gameKey) {
+    borrowedGames.remove(gameKey);
 }
 
 /*
@@ -104,26 +109,29 @@ Input       : None
 Return      : Number of borrowed games (int)
 ============================================================
 */
-int Member::getBorrowedCount() {
-    return borrowedGames.getLength();
+int Member::getBorrowedCount() const {
+    return borrowedGames.size();
 }
 
 /*
 ============================================================
 Function    : displayBorrowedGames
 Description : Displays all game IDs currently borrowed by
-              this member to the console.
+              this member to the console, in borrow order.
 Input       : None
 Return      : None
 ============================================================
 */
-void Member::displayBorrowedGames() {
+void Member::displayBorrowedGames() const {
     if (borrowedGames.isEmpty()) {
         cout << "No games borrowed." << endl;
     }
     else {
         cout << "Borrowed games: ";
-        borrowedGames.print();
+        for (int i = 0; i < borrowedGames.size(); i++) {
+            cout << gameIds.name(borrowedGames[i]) << " ";
+        }
+        cout << endl;
     }
 }
 
@@ -132,18 +140,13 @@ void Member::displayBorrowedGames() {
 Function    : hasBorrowed
 Description : Checks if the member has currently borrowed
               a specific game.
-Input       : gameID - Game identifier to check (string)
+Input       : gameKey - Interned game ID (IdHandle)
 Return      : True if member has borrowed the game, false
               otherwise (bool)
 ============================================================
 */
-bool Member::hasBorrowed(string gameID) {
-    for (int i = 0; i < borrowedGames.getLength(); i++) {
-        if (borrowedGames.get(i) == gameID) {
-            return true;
-        }
-    }
-    return false;
+bool Member::hasBorrowed(IdHandle gameKey) const {
+    return borrowedGames.contains(gameKey);
 }
 
 /*
@@ -158,7 +161,7 @@ Return      : None
 */
 void Member::display() {
     cout << "==================================" << endl;
-    cout << "Member ID: " << memberID << endl;
+    cout << "Member ID: " << getMemberID() << endl;
     cout << "Name: " << name << endl;
     cout << "Email: " << email << endl;
     cout << "Games borrowed: " << getBorrowedCount() << endl;
@@ -1,14 +1,20 @@
 #pragma once
 #include <string>
-#include "List.h"
+#include "SmallSet.h"
+#include "IdInterner.h"
 using namespace std;
 
+// Borrowed games kept inside the Member; more spill to the heap
+const int MEMBER_INLINE_BORROWS = 4;
+
 class Member {
 private:
-    string memberID;
+    // Handles of the games this member has out. 32 bytes on a
+    // 32-byte boundary, so borrow/return checks read one cache line.
+    alignas(32) SmallSet<IdHandle, MEMBER_INLINE_BORROWS> borrowedGames;
+    IdHandle memberKey;  // interned member ID
     string name;
     string email;
-    List borrowedGames; // List of game IDs this member has borrowed
 
 public:
     // Constructor
@@ -16,16 +22,17 @@ public:
     Member(string id, string n, string e);
 
     // Getters
-    string getMemberID();
-    string getName();
-    string getEmail();
+    const string& getMemberID() const;
+    IdHandle getMemberKey() const;
+    const string& getName() const;
+    const string& getEmail() const;
 
     // Borrow management
-    void addBorrowedGame(string gameID);
-    void removeBorrowedGame(string gameID);
-    int getBorrowedCount();
-    void displayBorrowedGames();
-    bool hasBorrowed(string gameID);
+    void addBorrowedGame(IdHandle gameKey);
+    void removeBorrowedGame(IdHandle gameKey);
+    int getBorrowedCount() const;
+    void displayBorrowedGames() const;
+    bool hasBorrowed(IdHandle gameKey) const;
 
     // Display
     void display();
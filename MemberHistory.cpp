@@ -0,0 +1,91 @@
+#include "MemberHistory.h"
+using namespace std;
+
+/*
+============================================================
+Function    : addRecord
+Description : Appends the BorrowRecord just stored at 'slot'
+              to the member's posting list, which counts the
+              borrow.
+Input       : slot - Index of the record in records[] (int,
+              the next unused slot)
+              memberKey - Borrowing member (IdHandle)
+Return      : None
+============================================================
+*/
+void MemberHistory::addRecord(int slot, IdHandle memberKey) {
+    byMember.add(slot, memberKey);
+}
+
+/*
+============================================================
+Function    : markReturned
+Description : Counts a return against the member's totals.
+Input       : memberKey - Returning member (IdHandle)
+Return      : None
+============================================================
+*/
+void MemberHistory::markReturned(IdHandle memberKey) {
+    byMember.addToTotal(memberKey, 1);
+}
+
+/*
+============================================================
+Function    : timesBorrowed
+Description : Returns how many times a member has borrowed.
+Input       : memberKey - Member handle (IdHandle)
+Return      : Borrow count (int)
+============================================================
+*/
+int MemberHistory::timesBorrowed(IdHandle memberKey) const {
+    return byMember.count(memberKey);
+}
+
+/*
+============================================================
+Function    : timesReturned
+Description : Returns how many of a member's loans have been
+              returned.
+Input       : memberKey - Member handle (IdHandle)
+Return      : Return count (int)
+============================================================
+*/
+int MemberHistory::timesReturned(IdHandle memberKey) const {
+    return byMember.total(memberKey);
+}
+
+/*
+============================================================
+Function    : currentlyOut
+Description : Returns how many games a member has out now.
+Input       : memberKey - Member handle (IdHandle)
+Return      : Open loan count (int)
+============================================================
+*/
+int MemberHistory::currentlyOut(IdHandle memberKey) const {
+    return byMember.count(memberKey) - byMember.total(memberKey);
+}
+
+/*
+============================================================
+Function    : firstRecord
+Description : Returns the slot of a member's oldest record.
+Input       : memberKey - Member handle (IdHandle)
+Return      : Slot in records[], -1 if none (int)
+============================================================
+*/
+int MemberHistory::firstRecord(IdHandle memberKey) const {
+    return byMember.first(memberKey);
+}
+
+/*
+============================================================
+Function    : nextRecordOf
+Description : Steps to the member's next record.
+Input       : slot - Current slot in records[] (int)
+Return      : Next slot, -1 at the end (int)
+============================================================
+*/
+int MemberHistory::nextRecordOf(int slot) const {
+    return byMember.next(slot);
+}
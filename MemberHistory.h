@@ -0,0 +1,28 @@
+#pragma once
+#include "PostingLists.h"
+
+/*
+============================================================
+Class       : MemberHistory
+Description : Per-member posting lists over the records[]
+              array: each member handle's BorrowRecord slots,
+              chained in borrow order. The list length is the
+              times borrowed and its running total the times
+              returned, so a member's totals are O(1) and a
+              summary walks only that member's own records.
+============================================================
+*/
+class MemberHistory {
+private:
+    PostingLists byMember;   // total = records returned
+
+public:
+    void addRecord(int slot, IdHandle memberKey);
+    void markReturned(IdHandle memberKey);
+
+    int timesBorrowed(IdHandle memberKey) const;
+    int timesReturned(IdHandle memberKey) const;
+    int currentlyOut(IdHandle memberKey) const;
+    int firstRecord(IdHandle memberKey) const;
+    int nextRecordOf(int slot) const;
+};
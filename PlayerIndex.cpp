@@ -0,0 +1,102 @@
+#include "PlayerIndex.h"
+using namespace std;
+
+/*
+============================================================
+Function    : clear
+Description : Empties every bucket. Used before a rebuild.
+Input       : None
+Return      : None
+============================================================
+*/
+void PlayerIndex::clear() {
+    for (int p = 0; p <= MAX_INDEXED_PLAYERS; p++) {
+        buckets[p].clear();
+    }
+}
+
+/*
+============================================================
+Function    : addGame
+Description : Registers a game appended at 'index' in every
+              bucket its player range covers. The new index is
+              the largest so far, so appending keeps each
+              bucket sorted.
+Input       : index - Position of the game in games[] (int)
+              minPlayers - Minimum players (int)
+              maxPlayers - Maximum players (int)
+Return      : None
+============================================================
+*/
+void PlayerIndex::addGame(int index, int minPlayers, int maxPlayers) {
+    int from = (minPlayers < 1) ? 1 : minPlayers;
+    int to = (maxPlayers > MAX_INDEXED_PLAYERS) ? MAX_INDEXED_PLAYERS : maxPlayers;
+    for (int p = from; p <= to; p++) {
+        buckets[p].add(index);
+    }
+}
+
+/*
+============================================================
+Function    : changeRange
+Description : Moves the game at 'index' (which stays where it
+              is) from the buckets of its old player range to
+              those of its new one. An empty range (min > max)
+              on either side adds or removes the game
+              outright. Only buckets the two ranges do not
+              share change, each by one binary-searched insert
+              or remove, so the buckets stay sorted.
+Input       : index - Position of the game in games[] (int)
+              oldMin, oldMax - Previous player range (int)
+              newMin, newMax - New player range (int)
+Return      : None
+============================================================
+*/
+void PlayerIndex::changeRange(int index, int oldMin, int oldMax, int newMin, int newMax) {
+    for (int p = 1; p <= MAX_INDEXED_PLAYERS; p++) {
+        bool inOld = p >= oldMin && p <= oldMax;
+        bool inNew = p >= newMin && p <= newMax;
+        if (inOld == inNew) continue;
+
+        DynamicArray<int>& bucket = buckets[p];
+        int low = 0, high = bucket.size();
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            if (bucket[mid] < index) low = mid + 1;
+            else high = mid;
+        }
+
+        if (inNew) {
+            bucket.insertAt(low, index);
+        }
+        else if (low < bucket.size() && bucket[low] == index) {
+            bucket.removeAt(low);
+        }
+    }
+}
+
+/*
+============================================================
+Function    : covers
+Description : Checks whether a player count has a bucket.
+Input       : numPlayers - Player count (int)
+Return      : True if the index can answer it (bool)
+============================================================
+*/
+bool PlayerIndex::covers(int numPlayers) const {
+    return numPlayers >= 1 && numPlayers <= MAX_INDEXED_PLAYERS;
+}
+
+/*
+============================================================
+Function    : gamesFor
+Description : Returns the bucket for a player count: every
+              matching games[] index, ascending. Only valid
+              when covers(numPlayers) is true.
+Input       : numPlayers - Player count (int)
+Return      : Matching indices (const DynamicArray<int>&)
+============================================================
+*/
+const DynamicArray<int>& PlayerIndex::gamesFor(int numPlayers) const {
+    return buckets[numPlayers];
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "DynamicArray.h"
+
+// Player counts 1..MAX_INDEXED_PLAYERS get their own bucket. Larger
+// counts are rare and fall back to a column scan.
+const int MAX_INDEXED_PLAYERS = 20;
+
+/*
+============================================================
+Class       : PlayerIndex
+Description : Bucket index from player count to the games[]
+              indices whose [minPlayers, maxPlayers] range
+              contains it. Each bucket is kept in ascending
+              index order, so enumerating a bucket gives the
+              same order as a linear scan of games[].
+============================================================
+*/
+class PlayerIndex {
+private:
+    DynamicArray<int> buckets[MAX_INDEXED_PLAYERS + 1];   // bucket 0 unused
+
+public:
+    void clear();
+    void addGame(int index, int minPlayers, int maxPlayers);
+    void changeRange(int index, int oldMin, int oldMax, int newMin, int newMax);
+
+    bool covers(int numPlayers) const;
+    const DynamicArray<int>& gamesFor(int numPlayers) const;
+};
@@ -0,0 +1,132 @@
+#include "PostingLists.h"
+using namespace std;
+
+/*
+============================================================
+Function    : findKey
+Description : Looks up the entry of a handle.
+Input       : key - Handle (IdHandle)
+Return      : Entry, or nullptr if the handle has no
+              postings yet (const Postings*)
+============================================================
+*/
+const PostingLists::Postings* PostingLists::findKey(IdHandle key) const {
+    if (key == NO_ID || key >= (IdHandle)perKey.size()) return nullptr;
+    return &perKey[key];
+}
+
+/*
+============================================================
+Function    : coverKey
+Description : Grows the per-handle table to cover 'key', with
+              empty lists for the new handles.
+Input       : key - Handle (IdHandle, not NO_ID)
+Return      : None
+============================================================
+*/
+void PostingLists::coverKey(IdHandle key) {
+    if (key < (IdHandle)perKey.size()) return;
+
+    int oldSize = perKey.size();
+    perKey.resize((int)key + 1);
+    for (int i = oldSize; i < perKey.size(); i++) {
+        perKey[i].first = -1;
+        perKey[i].last = -1;
+        perKey[i].count = 0;
+        perKey[i].total = 0;
+    }
+}
+
+/*
+============================================================
+Function    : add
+Description : Appends the element just stored at 'position'
+              to the handle's list.
+Input       : position - Index in the indexed array (int,
+              the next unused position)
+              key - Handle the element belongs to (IdHandle)
+Return      : None
+============================================================
+*/
+void PostingLists::add(int position, IdHandle key) {
+    if (key == NO_ID) return;
+
+    coverKey(key);
+    if (position >= nextPosition.size()) {
+        nextPosition.resize(position + 1);
+    }
+    nextPosition[position] = -1;
+
+    Postings& entry = perKey[key];
+    if (entry.last == -1) entry.first = position;
+    else nextPosition[entry.last] = position;
+    entry.last = position;
+    entry.count++;
+}
+
+/*
+============================================================
+Function    : addToTotal
+Description : Adds to a handle's running total.
+Input       : key - Handle (IdHandle)
+              amount - Value to add (int)
+Return      : None
+============================================================
+*/
+void PostingLists::addToTotal(IdHandle key, int amount) {
+    if (key == NO_ID) return;
+
+    coverKey(key);
+    perKey[key].total += amount;
+}
+
+/*
+============================================================
+Function    : count
+Description : Returns how many positions a handle has.
+Input       : key - Handle (IdHandle)
+Return      : Length of the list (int)
+============================================================
+*/
+int PostingLists::count(IdHandle key) const {
+    const Postings* entry = findKey(key);
+    return (entry == nullptr) ? 0 : entry->count;
+}
+
+/*
+============================================================
+Function    : total
+Description : Returns a handle's running total.
+Input       : key - Handle (IdHandle)
+Return      : Total, 0 if never added to (int)
+============================================================
+*/
+int PostingLists::total(IdHandle key) const {
+    const Postings* entry = findKey(key);
+    return (entry == nullptr) ? 0 : entry->total;
+}
+
+/*
+============================================================
+Function    : first
+Description : Returns a handle's oldest position.
+Input       : key - Handle (IdHandle)
+Return      : Position, -1 if none (int)
+============================================================
+*/
+int PostingLists::first(IdHandle key) const {
+    const Postings* entry = findKey(key);
+    return (entry == nullptr) ? -1 : entry->first;
+}
+
+/*
+============================================================
+Function    : next
+Description : Steps to the next position of the same handle.
+Input       : position - Current position (int)
+Return      : Next position, -1 at the end (int)
+============================================================
+*/
+int PostingLists::next(int position) const {
+    return nextPosition[position];
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include "DynamicArray.h"
+#include "IdInterner.h"
+
+/*
+============================================================
+Class       : PostingLists
+Description : One posting list per handle over an append-only
+              array (reviews[], records[]). Each handle keeps
+              the first and last of its positions, chained in
+              insertion order through a next-position array
+              parallel to the indexed array, plus the number
+              of positions and a running total whose meaning
+              the owner chooses (a rating sum, a return
+              count). Appending and every per-handle figure
+              are O(1); walking a handle's list visits only
+              its own positions.
+============================================================
+*/
+class PostingLists {
+private:
+    struct Postings {
+        int first;       // first position, -1 if none
+        int last;        // most recent position
+        int count;
+        int total;
+    };
+
+    DynamicArray<Postings> perKey;       // indexed by handle
+    DynamicArray<int> nextPosition;      // per position: next of the same handle, -1 ends
+
+    const Postings* findKey(IdHandle key) const;
+    void coverKey(IdHandle key);
+
+public:
+    void add(int position, IdHandle key);
+    void addToTotal(IdHandle key, int amount);
+
+    int count(IdHandle key) const;
+    int total(IdHandle key) const;
+    int first(IdHandle key) const;
+    int next(int position) const;
+};
@@ -12,8 +12,8 @@ Return      : None
 ============================================================
 */
 Review::Review() {
-    gameID = "";
-    memberID = "";
+    gameKey = NO_ID;
+    memberKey = NO_ID;
     memberName = "";
     rating = 0;
     reviewText = "";
@@ -25,8 +25,8 @@ Review::Review() {
 Function    : Review (Parameterized Constructor)
 Description : Initializes a Review object with the provided
               review details.
-Input       : gID - Game ID (string)
-              mID - Member ID (string)
+Input       : gKey - Game handle (IdHandle)
+              mKey - Member handle (IdHandle)
               mName - Member name (string)
               r - Rating from 1-10 (int)
               text - Review text (string)
@@ -34,9 +34,9 @@ Input       : gID - Game ID (string)
 Return      : None
 ============================================================
 */
-Review::Review(string gID, string mID, string mName, int r, string text, string d) {
-    gameID = gID;
-    memberID = mID;
+Review::Review(IdHandle gKey, IdHandle mKey, string mName, int r, string text, string d) {
+    gameKey = gKey;
+    memberKey = mKey;
     memberName = mName;
     rating = r;
     reviewText = text;
@@ -48,30 +48,50 @@ Review::Review(string gID, string mID, string mName, int r, string text, string
 Function    : getGameID
 Description : Returns the game ID of the reviewed game.
 Input       : None
-Return      : Game ID (string)
+Return      : Game ID (const string&)
 ============================================================
 */
-string Review::getGameID() { return gameID; }
+const string& Review::getGameID() const { return gameIds.name(gameKey); }
 
 /*
 ============================================================
 Function    : getMemberID
 Description : Returns the member ID of the reviewer.
 Input       : None
-Return      : Member ID (string)
+Return      : Member ID (const string&)
 ============================================================
 */
-string Review::getMemberID() { return memberID; }
+const string& Review::getMemberID() const { return memberIds.name(memberKey); }
+
+/*
+============================================================
+Function    : getGameKey
+Description : Returns the handle of the reviewed game.
+Input       : None
+Return      : Game handle (IdHandle)
+============================================================
+*/
+IdHandle Review::getGameKey() const { return gameKey; }
+
+/*
+============================================================
+Function    : getMemberKey
+Description : Returns the handle of the reviewer.
+Input       : None
+Return      : Member handle (IdHandle)
+============================================================
+*/
+IdHandle Review::getMemberKey() const { return memberKey; }
 
 /*
 ============================================================
 Function    : getMemberName
 Description : Returns the name of the reviewer.
 Input       : None
-Return      : Member name (string)
+Return      : Member name (const string&)
 ============================================================
 */
-string Review::getMemberName() { return memberName; }
+const string& Review::getMemberName() const { return memberName; }
 
 /*
 ============================================================
@@ -81,27 +101,27 @@ Input       : None
 Return      : Rating (1-10) (int)
 ============================================================
 */
-int Review::getRating() { return rating; }
+int Review::getRating() const { return rating; }
 
 /*
 ============================================================
 Function    : getReviewText
 Description : Returns the text content of the review.
 Input       : None
-Return      : Review text (string)
+Return      : Review text (const string&)
 ============================================================
 */
-string Review::getReviewText() { return reviewText; }
+const string& Review::getReviewText() const { return reviewText; }
 
 /*
 ============================================================
 Function    : getDate
 Description : Returns the date the review was written.
 Input       : None
-Return      : Review date (string)
+Return      : Review date (const string&)
 ============================================================
 */
-string Review::getDate() { return date; }
+const string& Review::getDate() const { return date; }
 
 /*
 ============================================================
@@ -115,7 +135,7 @@ Return      : None
 */
 void Review::display() {
     cout << "----------------------------------------" << endl;
-    cout << "Reviewer: " << memberName << " (" << memberID << ")" << endl;
+    cout << "Reviewer: " << memberName << " (" << getMemberID() << ")" << endl;
     cout << "Rating: " << rating << "/10" << endl;
     cout << "Review: " << reviewText << endl;
     cout << "Date: " << date << endl;
@@ -1,11 +1,12 @@
 #pragma once
 #include <string>
+#include "IdInterner.h"
 using namespace std;
 
 class Review {
 private:
-    string gameID;
-    string memberID;
+    IdHandle gameKey;
+    IdHandle memberKey;
     string memberName;
     int rating;        // 1-10
     string reviewText;
@@ -14,15 +15,17 @@ private:
 public:
     // Constructor
     Review();
-    Review(string gID, string mID, string mName, int r, string text, string d);
+    Review(IdHandle gKey, IdHandle mKey, string mName, int r, string text, string d);
 
     // Getters
-    string getGameID();
-    string getMemberID();
-    string getMemberName();
-    int getRating();
-    string getReviewText();
-    string getDate();
+    const string& getGameID() const;
+    const string& getMemberID() const;
+    IdHandle getGameKey() const;
+    IdHandle getMemberKey() const;
+    const string& getMemberName() const;
+    int getRating() const;
+    const string& getReviewText() const;
+    const string& getDate() const;
 
     // Display
     void display();
@@ -0,0 +1,71 @@
+#include "ReviewIndex.h"
+using namespace std;
+
+/*
+============================================================
+Function    : addReview
+Description : Registers the review just stored at 'position'
+              in reviews[]: links it after the game's last
+              review and adds its rating to the running sum.
+Input       : position - Index of the review in reviews[]
+              (int, the next unused position)
+              gameKey - Reviewed game (IdHandle)
+              rating - Rating given (int)
+Return      : None
+============================================================
+*/
+void ReviewIndex::addReview(int position, IdHandle gameKey, int rating) {
+    byGame.add(position, gameKey);
+    byGame.addToTotal(gameKey, rating);
+}
+
+/*
+============================================================
+Function    : reviewCount
+Description : Returns how many reviews a game has.
+Input       : gameKey - Game handle (IdHandle)
+Return      : Number of reviews (int)
+============================================================
+*/
+int ReviewIndex::reviewCount(IdHandle gameKey) const {
+    return byGame.count(gameKey);
+}
+
+/*
+============================================================
+Function    : averageRating
+Description : Returns a game's average rating from its running
+              sum and count.
+Input       : gameKey - Game handle (IdHandle)
+Return      : Average rating, 0.0 if no reviews (double)
+============================================================
+*/
+double ReviewIndex::averageRating(IdHandle gameKey) const {
+    int count = byGame.count(gameKey);
+    if (count == 0) return 0.0;
+    return (double)byGame.total(gameKey) / count;
+}
+
+/*
+============================================================
+Function    : firstReview
+Description : Returns the position of a game's oldest review.
+Input       : gameKey - Game handle (IdHandle)
+Return      : Position in reviews[], -1 if none (int)
+============================================================
+*/
+int ReviewIndex::firstReview(IdHandle gameKey) const {
+    return byGame.first(gameKey);
+}
+
+/*
+============================================================
+Function    : nextReviewOf
+Description : Steps to the next review of the same game.
+Input       : position - Current position in reviews[] (int)
+Return      : Next position, -1 at the end (int)
+============================================================
+*/
+int ReviewIndex::nextReviewOf(int position) const {
+    return byGame.next(position);
+}
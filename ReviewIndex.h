@@ -0,0 +1,27 @@
+#pragma once
+#include "PostingLists.h"
+
+/*
+============================================================
+Class       : ReviewIndex
+Description : Per-game index over the reviews[] array: one
+              posting list per game handle, chained in
+              insertion order, whose running total is the
+              game's rating sum. Average ratings are O(1) and
+              listing a game's reviews visits only that game's
+              entries. Reviews are only ever appended, so the
+              index is updated in O(1) alongside reviews[].
+============================================================
+*/
+class ReviewIndex {
+private:
+    PostingLists byGame;   // total = sum of the game's ratings
+
+public:
+    void addReview(int position, IdHandle gameKey, int rating);
+
+    int reviewCount(IdHandle gameKey) const;
+    double averageRating(IdHandle gameKey) const;
+    int firstReview(IdHandle gameKey) const;
+    int nextReviewOf(int position) const;
+};
@@ -0,0 +1,244 @@
+#pragma once
+#include <new>
+#include "DynamicArray.h"
+
+const int SEGMENT_SHIFT = 6;                     // log2 of the elements per segment
+const int SEGMENT_ITEMS = 1 << SEGMENT_SHIFT;    // elements per segment
+
+/*
+============================================================
+Class       : SegmentedArray
+Description : Growable array for objects that own memory
+              (Game, Member, records ...). Elements live in
+              fixed segments of SEGMENT_ITEMS, allocated only
+              when the previous one is full; the array keeps
+              a directory of segment pointers. Growing never
+              moves an element, so references and pointers
+              into the array stay valid for as long as the
+              element exists, and memory follows the number
+              of elements actually stored. An element is only
+              constructed when it is added, never up front.
+              Indexing is a shift and a mask. Not copyable;
+              swap() exchanges two arrays in O(1). Templates
+              must be defined in the header, so the member
+              functions live below the class.
+============================================================
+*/
+template <class T>
+class SegmentedArray {
+private:
+    struct Cell {
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    DynamicArray<Cell*> segments;   // SEGMENT_ITEMS cells each
+    int count;                      // elements constructed, from index 0
+
+    T* cellAt(int index) const;
+    T* reserveNext();
+
+    // Not copyable: owns its segments
+    SegmentedArray(const SegmentedArray&);
+    SegmentedArray& operator=(const SegmentedArray&);
+
+public:
+    SegmentedArray();
+    ~SegmentedArray();
+
+    T& add(const T& item);
+    T& add(T&& item);
+    void resize(int newCount);
+    void clear();
+    void swap(SegmentedArray& other);
+
+    int size() const;
+    bool isEmpty() const;
+    T& operator[](int index);
+    const T& operator[](int index) const;
+};
+
+/*
+============================================================
+Function    : SegmentedArray (Constructor)
+Description : Creates an empty array; no segment is allocated
+              until the first add.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T>
+SegmentedArray<T>::SegmentedArray() {
+    count = 0;
+}
+
+/*
+============================================================
+Function    : ~SegmentedArray (Destructor)
+Description : Destroys the elements and frees every segment.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T>
+SegmentedArray<T>::~SegmentedArray() {
+    clear();
+    for (int s = 0; s < segments.size(); s++) {
+        delete[] segments[s];
+    }
+}
+
+/*
+============================================================
+Function    : cellAt
+Description : Locates the storage of an element: the segment
+              is index >> SEGMENT_SHIFT, the cell within it
+              the low bits.
+Input       : index - Element position (int)
+Return      : Pointer to the element's storage (T*)
+============================================================
+*/
+template <class T>
+T* SegmentedArray<T>::cellAt(int index) const {
+    Cell* segment = segments[index >> SEGMENT_SHIFT];
+    return reinterpret_cast<T*>(segment[index & (SEGMENT_ITEMS - 1)].storage);
+}
+
+/*
+============================================================
+Function    : reserveNext
+Description : Makes sure the cell after the last element
+              exists, allocating a new segment when every
+              segment is full.
+Input       : None
+Return      : Storage for element 'count', not yet
+              constructed (T*)
+============================================================
+*/
+template <class T>
+T* SegmentedArray<T>::reserveNext() {
+    if (count == segments.size() * SEGMENT_ITEMS) {
+        segments.add(new Cell[SEGMENT_ITEMS]);
+    }
+    return cellAt(count);
+}
+
+/*
+============================================================
+Function    : add
+Description : Appends a copy of (or moves in) an element.
+              Existing elements do not move.
+Input       : item - Element to append (const T& / T&&)
+Return      : Reference to the stored element (T&)
+============================================================
+*/
+template <class T>
+T& SegmentedArray<T>::add(const T& item) {
+    T* element = new (reserveNext()) T(item);
+    count++;
+    return *element;
+}
+
+template <class T>
+T& SegmentedArray<T>::add(T&& item) {
+    T* element = new (reserveNext()) T(static_cast<T&&>(item));
+    count++;
+    return *element;
+}
+
+/*
+============================================================
+Function    : resize
+Description : Sets the number of elements. New elements are
+              default-constructed; elements past the new end
+              are destroyed (their segments are kept for
+              reuse).
+Input       : newCount - New element count (int)
+Return      : None
+============================================================
+*/
+template <class T>
+void SegmentedArray<T>::resize(int newCount) {
+    while (count > newCount) {
+        count--;
+        cellAt(count)->~T();
+    }
+    while (count < newCount) {
+        new (reserveNext()) T();
+        count++;
+    }
+}
+
+/*
+============================================================
+Function    : clear
+Description : Destroys every element. The segments are kept,
+              so refilling the array allocates nothing.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T>
+void SegmentedArray<T>::clear() {
+    resize(0);
+}
+
+/*
+============================================================
+Function    : swap
+Description : Exchanges contents with another array in O(1)
+              (only the segment directories change hands).
+Input       : other - Array to swap with (SegmentedArray&)
+Return      : None
+============================================================
+*/
+template <class T>
+void SegmentedArray<T>::swap(SegmentedArray& other) {
+    segments.swap(other.segments);
+    int count0 = count;
+    count = other.count;
+    other.count = count0;
+}
+
+/*
+============================================================
+Function    : size
+Description : Returns the number of elements.
+Input       : None
+Return      : Element count (int)
+============================================================
+*/
+template <class T>
+int SegmentedArray<T>::size() const {
+    return count;
+}
+
+/*
+============================================================
+Function    : isEmpty
+Description : Checks if the array has no elements.
+Input       : None
+Return      : True if empty, false otherwise (bool)
+============================================================
+*/
+template <class T>
+bool SegmentedArray<T>::isEmpty() const {
+    return count == 0;
+}
+
+/*
+============================================================
+Function    : operator[]
+Description : Accesses the element at 'index' (unchecked).
+Input       : index - Element position, 0..size()-1 (int)
+Return      : Reference to the element (T&)
+============================================================
+*/
+template <class T>
+T& SegmentedArray<T>::operator[](int index) {
+    return *cellAt(index);
+}
+
+template <class T>
+const T& SegmentedArray<T>::operator[](int index) const {
+    return *cellAt(index);
+}
@@ -0,0 +1,159 @@
+#include "SlotMap.h"
+
+/*
+============================================================
+Function    : SlotMap (Constructor)
+Description : Creates a map with no slots.
+Input       : None
+Return      : None
+============================================================
+*/
+SlotMap::SlotMap() {
+    liveCount = 0;
+}
+
+/*
+============================================================
+Function    : reset
+Description : Starts over with slots 0..slots-1 all live, as
+              after a bulk load into the front of the array.
+Input       : slots - Number of live slots (int)
+Return      : None
+============================================================
+*/
+void SlotMap::reset(int slots) {
+    live.resize(slots);
+    for (int i = 0; i < slots; i++) {
+        live[i] = 1;
+    }
+    freeSlots.clear();
+    liveCount = slots;
+}
+
+/*
+============================================================
+Function    : acquire
+Description : Marks a slot live and returns it: the lowest
+              free slot if there is one, otherwise a new slot
+              at the end. The caller checks capacity first.
+Input       : None
+Return      : Slot to store the new element in (int)
+============================================================
+*/
+int SlotMap::acquire() {
+    int slot;
+    if (!freeSlots.isEmpty()) {
+        slot = popFree();
+    }
+    else {
+        slot = live.size();
+        live.add(0);
+    }
+    live[slot] = 1;
+    liveCount++;
+    return slot;
+}
+
+/*
+============================================================
+Function    : release
+Description : Frees a live slot and pushes it onto the free
+              heap.
+Input       : slot - Slot to free (int)
+Return      : None
+============================================================
+*/
+void SlotMap::release(int slot) {
+    if (!isLive(slot)) return;
+    live[slot] = 0;
+    liveCount--;
+    pushFree(slot);
+}
+
+/*
+============================================================
+Function    : pushFree
+Description : Adds a slot to the free heap, moving it up past
+              every larger parent.
+Input       : slot - Free slot (int)
+Return      : None
+============================================================
+*/
+void SlotMap::pushFree(int slot) {
+    int pos = freeSlots.size();
+    freeSlots.add(slot);
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (freeSlots[parent] <= slot) break;
+        freeSlots[pos] = freeSlots[parent];
+        pos = parent;
+    }
+    freeSlots[pos] = slot;
+}
+
+/*
+============================================================
+Function    : popFree
+Description : Removes the lowest free slot from the heap: the
+              last entry takes the root and moves down past
+              every smaller child.
+Input       : None (the heap must not be empty)
+Return      : Lowest free slot (int)
+============================================================
+*/
+int SlotMap::popFree() {
+    int lowest = freeSlots[0];
+    int last = freeSlots[freeSlots.size() - 1];
+    freeSlots.removeAt(freeSlots.size() - 1);
+    int n = freeSlots.size();
+    if (n == 0) return lowest;
+
+    int pos = 0;
+    while (true) {
+        int child = 2 * pos + 1;
+        if (child >= n) break;
+        if (child + 1 < n && freeSlots[child + 1] < freeSlots[child]) child++;
+        if (freeSlots[child] >= last) break;
+        freeSlots[pos] = freeSlots[child];
+        pos = child;
+    }
+    freeSlots[pos] = last;
+    return lowest;
+}
+
+/*
+============================================================
+Function    : isLive
+Description : Checks whether a slot holds an element.
+Input       : slot - Slot to check (int)
+Return      : True if live (bool)
+============================================================
+*/
+bool SlotMap::isLive(int slot) const {
+    return slot >= 0 && slot < live.size() && live[slot] != 0;
+}
+
+/*
+============================================================
+Function    : size
+Description : Returns the number of live slots.
+Input       : None
+Return      : Live element count (int)
+============================================================
+*/
+int SlotMap::size() const {
+    return liveCount;
+}
+
+/*
+============================================================
+Function    : slotCount
+Description : Returns one past the highest slot ever used;
+              iteration covers 0..slotCount()-1.
+Input       : None
+Return      : Slot count, live and free (int)
+============================================================
+*/
+int SlotMap::slotCount() const {
+    return live.size();
+}
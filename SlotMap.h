@@ -0,0 +1,42 @@
+#pragma once
+#include "DynamicArray.h"
+
+/*
+============================================================
+Class       : SlotMap
+Description : Bookkeeping for an array whose elements never
+              move (games[]). Each slot is live or free;
+              removing an element frees its slot in O(1)
+              instead of shifting every later element, so
+              positions held by indexes stay valid. Freed
+              slots are reused lowest first, so which slot an
+              add gets depends only on the set of holes: a
+              snapshot, which stores holes by position, reloads
+              to the same layout, and listings in slot order
+              match across a restart. The free slots are kept
+              in a binary min-heap, O(log holes) per release
+              and acquire.
+              The owner iterates 0..slotCount()-1 and skips
+              slots that are not live.
+============================================================
+*/
+class SlotMap {
+private:
+    DynamicArray<unsigned char> live;
+    DynamicArray<int> freeSlots;   // min-heap: freeSlots[0] is the lowest
+    int liveCount;
+
+    void pushFree(int slot);
+    int popFree();
+
+public:
+    SlotMap();
+
+    void reset(int slots);
+    int acquire();
+    void release(int slot);
+
+    bool isLive(int slot) const;
+    int size() const;
+    int slotCount() const;
+};
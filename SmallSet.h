@@ -0,0 +1,299 @@
+#pragma once
+#include <cstring>
+
+/*
+============================================================
+Class       : SmallSet
+Description : Set of up to N plain values (handles, ints)
+              stored inline, inside the owning object, in the
+              order they were added. Only a set that grows
+              past N moves to a heap array, which then doubles
+              like DynamicArray. With small N the whole set is
+              a few contiguous words, so a membership test is
+              a short linear scan with no pointer chasing. T
+              must be trivially copyable (values are moved
+              with memcpy). Templates must be defined in the
+              header, so the member functions live below the
+              class.
+============================================================
+*/
+template <class T, int N>
+class SmallSet {
+private:
+    int count;
+    int capacity;      // N while inline
+    T* heapItems;      // nullptr while inline
+    T inlineItems[N];
+
+    T* items();
+    const T* items() const;
+    void copyFrom(const SmallSet& other);
+    void release();
+
+public:
+    SmallSet();
+    SmallSet(const SmallSet& other);
+    SmallSet& operator=(const SmallSet& other);
+    SmallSet(SmallSet&& other) noexcept;
+    SmallSet& operator=(SmallSet&& other) noexcept;
+    ~SmallSet();
+
+    bool add(const T& item);
+    bool remove(const T& item);
+    bool contains(const T& item) const;
+    void clear();
+
+    int size() const;
+    bool isEmpty() const;
+    bool isInline() const;
+    const T& operator[](int index) const;
+};
+
+/*
+============================================================
+Function    : SmallSet (Constructor)
+Description : Creates an empty set using the inline slots.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T, int N>
+SmallSet<T, N>::SmallSet() {
+    count = 0;
+    capacity = N;
+    heapItems = nullptr;
+}
+
+/*
+============================================================
+Function    : SmallSet (Copy Constructor / Assignment)
+Description : Copies another set's values; a heap array is
+              only allocated if they do not fit inline.
+Input       : other - Set to copy (const SmallSet&)
+Return      : None / this set (SmallSet&)
+============================================================
+*/
+template <class T, int N>
+SmallSet<T, N>::SmallSet(const SmallSet& other) {
+    count = 0;
+    capacity = N;
+    heapItems = nullptr;
+    copyFrom(other);
+}
+
+template <class T, int N>
+SmallSet<T, N>& SmallSet<T, N>::operator=(const SmallSet& other) {
+    if (this != &other) {
+        clear();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+/*
+============================================================
+Function    : SmallSet (Move Constructor / Assignment)
+Description : Takes over another set's heap array if it has
+              one, otherwise copies its inline values. The
+              other set is left empty.
+Input       : other - Set to move from (SmallSet&&)
+Return      : None / this set (SmallSet&)
+============================================================
+*/
+template <class T, int N>
+SmallSet<T, N>::SmallSet(SmallSet&& other) noexcept {
+    count = 0;
+    capacity = N;
+    heapItems = nullptr;
+    *this = static_cast<SmallSet&&>(other);
+}
+
+template <class T, int N>
+SmallSet<T, N>& SmallSet<T, N>::operator=(SmallSet&& other) noexcept {
+    if (this == &other) return *this;
+    release();
+    if (other.heapItems != nullptr) {
+        heapItems = other.heapItems;
+        capacity = other.capacity;
+        other.heapItems = nullptr;
+        other.capacity = N;
+    }
+    else {
+        memcpy(inlineItems, other.inlineItems, other.count * sizeof(T));
+    }
+    count = other.count;
+    other.count = 0;
+    return *this;
+}
+
+/*
+============================================================
+Function    : ~SmallSet (Destructor)
+Description : Frees the heap array, if the set ever needed one.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T, int N>
+SmallSet<T, N>::~SmallSet() {
+    release();
+}
+
+// Where the values currently live
+template <class T, int N>
+T* SmallSet<T, N>::items() {
+    return (heapItems != nullptr) ? heapItems : inlineItems;
+}
+
+template <class T, int N>
+const T* SmallSet<T, N>::items() const {
+    return (heapItems != nullptr) ? heapItems : inlineItems;
+}
+
+/*
+============================================================
+Function    : copyFrom
+Description : Copies another set's values into this empty one.
+Input       : other - Set to copy (const SmallSet&)
+Return      : None
+============================================================
+*/
+template <class T, int N>
+void SmallSet<T, N>::copyFrom(const SmallSet& other) {
+    if (other.count > N) {
+        heapItems = new T[other.count];
+        capacity = other.count;
+    }
+    memcpy(items(), other.items(), other.count * sizeof(T));
+    count = other.count;
+}
+
+/*
+============================================================
+Function    : release
+Description : Frees the heap array and goes back to the inline
+              slots, empty.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T, int N>
+void SmallSet<T, N>::release() {
+    delete[] heapItems;
+    heapItems = nullptr;
+    capacity = N;
+    count = 0;
+}
+
+/*
+============================================================
+Function    : add
+Description : Appends a value that is not in the set yet. The
+              set moves to the heap when it outgrows the
+              inline slots and doubles from there.
+Input       : item - Value to add (const T&)
+Return      : False if it was already present (bool)
+============================================================
+*/
+template <class T, int N>
+bool SmallSet<T, N>::add(const T& item) {
+    if (contains(item)) return false;
+    if (count == capacity) {
+        T* grown = new T[capacity * 2];
+        memcpy(grown, items(), count * sizeof(T));
+        delete[] heapItems;
+        heapItems = grown;
+        capacity *= 2;
+    }
+    items()[count++] = item;
+    return true;
+}
+
+/*
+============================================================
+Function    : remove
+Description : Removes a value, shifting the later ones down so
+              the order of addition is kept.
+Input       : item - Value to remove (const T&)
+Return      : False if it was not in the set (bool)
+============================================================
+*/
+template <class T, int N>
+bool SmallSet<T, N>::remove(const T& item) {
+    T* values = items();
+    for (int i = 0; i < count; i++) {
+        if (values[i] == item) {
+            memmove(values + i, values + i + 1, (count - i - 1) * sizeof(T));
+            count--;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+============================================================
+Function    : contains
+Description : Linear scan of the (inline, while small) values.
+Input       : item - Value to look for (const T&)
+Return      : True if present (bool)
+============================================================
+*/
+template <class T, int N>
+bool SmallSet<T, N>::contains(const T& item) const {
+    const T* values = items();
+    for (int i = 0; i < count; i++) {
+        if (values[i] == item) return true;
+    }
+    return false;
+}
+
+/*
+============================================================
+Function    : clear
+Description : Removes every value and frees any heap array.
+Input       : None
+Return      : None
+============================================================
+*/
+template <class T, int N>
+void SmallSet<T, N>::clear() {
+    release();
+}
+
+/*
+============================================================
+Function    : size / isEmpty / isInline
+Description : Number of values, whether there are none, and
+              whether they still fit in the inline slots.
+Input       : None
+Return      : int / bool / bool
+============================================================
+*/
+template <class T, int N>
+int SmallSet<T, N>::size() const {
+    return count;
+}
+
+template <class T, int N>
+bool SmallSet<T, N>::isEmpty() const {
+    return count == 0;
+}
+
+template <class T, int N>
+bool SmallSet<T, N>::isInline() const {
+    return heapItems == nullptr;
+}
+
+/*
+============================================================
+Function    : operator[]
+Description : Value at a position, in order of addition.
+Input       : index - Position, 0..size()-1 (int)
+Return      : The value (const T&)
+============================================================
+*/
+template <class T, int N>
+const T& SmallSet<T, N>::operator[](int index) const {
+    return items()[index];
+}
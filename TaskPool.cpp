@@ -0,0 +1,300 @@
+#include "TaskPool.h"
+using namespace std;
+
+// Which pool and queue the running thread owns (none for main)
+static thread_local const TaskPool* ownerPool = nullptr;
+static thread_local int ownerQueue = -1;
+
+/*
+============================================================
+Function    : TaskGroup (Constructor)
+Description : Creates a group with no pending tasks.
+Input       : None
+Return      : None
+============================================================
+*/
+TaskGroup::TaskGroup() : pending(0) {
+}
+
+/*
+============================================================
+Function    : TaskPool (Constructor)
+Description : Creates the queues for threadCount - 1 workers;
+              the thread that waits on a group is the last
+              pair of hands. The workers themselves are started
+              by the first spawn().
+Input       : threadCount - Threads that run tasks, including
+              the caller (int, at least 1)
+Return      : None
+============================================================
+*/
+TaskPool::TaskPool(int threadCount) : queuedTasks(0), stopping(false) {
+    if (threadCount < 1) threadCount = 1;
+    workerCount = threadCount - 1;
+    queueCount = workerCount + 1;
+
+    queues = new TaskQueue[queueCount];
+    for (int i = 0; i < queueCount; i++) {
+        queues[i].head = 0;
+        queues[i].count = 0;
+    }
+
+    workers = new thread[workerCount > 0 ? workerCount : 1];
+}
+
+/*
+============================================================
+Function    : startWorkers
+Description : Starts the worker threads. Called once, by the
+              first spawn().
+Input       : None
+Return      : None
+============================================================
+*/
+void TaskPool::startWorkers() {
+    for (int i = 0; i < workerCount; i++) {
+        workers[i] = thread(&TaskPool::workerLoop, this, i);
+    }
+}
+
+/*
+============================================================
+Function    : ~TaskPool (Destructor)
+Description : Wakes every started worker, lets it exit and
+              joins it. Callers must have waited on their
+              groups first.
+Input       : None
+Return      : None
+============================================================
+*/
+TaskPool::~TaskPool() {
+    {
+        lock_guard<mutex> guard(sleepLock);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (int i = 0; i < workerCount; i++) {
+        if (workers[i].joinable()) workers[i].join();
+    }
+    delete[] workers;
+    delete[] queues;
+}
+
+/*
+============================================================
+Function    : threadCount
+Description : Returns how many threads run tasks, counting the
+              waiting caller.
+Input       : None
+Return      : Thread count (int)
+============================================================
+*/
+int TaskPool::threadCount() const {
+    return workerCount + 1;
+}
+
+/*
+============================================================
+Function    : currentQueue
+Description : Finds the queue owned by the running thread. A
+              thread that is not one of this pool's workers
+              uses the shared outside queue (the last one).
+Input       : None
+Return      : Queue index (int)
+============================================================
+*/
+int TaskPool::currentQueue() const {
+    if (ownerPool == this) return ownerQueue;
+    return workerCount;
+}
+
+/*
+============================================================
+Function    : popOwn
+Description : Takes the newest task from the back of a queue.
+Input       : queue - Queue to pop (int)
+              task - Receives the task (Task&)
+Return      : True if a task was taken (bool)
+============================================================
+*/
+bool TaskPool::popOwn(int queue, Task& task) {
+    TaskQueue& q = queues[queue];
+    lock_guard<mutex> guard(q.lock);
+    if (q.count == 0) return false;
+    q.count--;
+    task = q.items[(q.head + q.count) % TASK_QUEUE_CAPACITY];
+    return true;
+}
+
+/*
+============================================================
+Function    : steal
+Description : Takes the oldest task from the front of the
+              first other queue that has one, starting just
+              after the thief's own queue.
+Input       : thief - Queue of the stealing thread (int)
+              task - Receives the task (Task&)
+Return      : True if a task was stolen (bool)
+============================================================
+*/
+bool TaskPool::steal(int thief, Task& task) {
+    for (int step = 1; step < queueCount; step++) {
+        TaskQueue& q = queues[(thief + step) % queueCount];
+        lock_guard<mutex> guard(q.lock);
+        if (q.count == 0) continue;
+        task = q.items[q.head];
+        q.head = (q.head + 1) % TASK_QUEUE_CAPACITY;
+        q.count--;
+        return true;
+    }
+    return false;
+}
+
+/*
+============================================================
+Function    : execute
+Description : Runs a task and marks it finished in its group.
+Input       : task - Task to run (const Task&)
+Return      : None
+============================================================
+*/
+void TaskPool::execute(const Task& task) {
+    task.run(task.arg);
+    task.group->pending.fetch_sub(1, memory_order_release);
+}
+
+/*
+============================================================
+Function    : runOne
+Description : Runs one task from the caller's own queue, or a
+              stolen one if its queue is empty.
+Input       : queue - Queue of the running thread (int)
+Return      : True if a task was run (bool)
+============================================================
+*/
+bool TaskPool::runOne(int queue) {
+    Task task;
+    if (!popOwn(queue, task) && !steal(queue, task)) {
+        return false;
+    }
+    queuedTasks.fetch_sub(1, memory_order_relaxed);
+    execute(task);
+    return true;
+}
+
+/*
+============================================================
+Function    : workerLoop
+Description : Body of a worker thread: runs tasks while there
+              are any and sleeps until more are spawned.
+Input       : queue - Queue owned by this worker (int)
+Return      : None
+============================================================
+*/
+void TaskPool::workerLoop(int queue) {
+    ownerPool = this;
+    ownerQueue = queue;
+
+    while (true) {
+        if (runOne(queue)) continue;
+
+        unique_lock<mutex> guard(sleepLock);
+        wakeUp.wait(guard, [this] {
+            return stopping || queuedTasks.load(memory_order_relaxed) > 0;
+        });
+        if (stopping) break;
+    }
+}
+
+/*
+============================================================
+Function    : spawn
+Description : Queues a task on the calling thread's queue as
+              part of a group, starting the workers the first
+              time. Runs it straight away when the queue is
+              full.
+Input       : group - Group the task belongs to (TaskGroup&)
+              run - Function to call (TaskFunction)
+              arg - Argument passed to it (void*); must stay
+              valid until the group has been waited on
+Return      : None
+============================================================
+*/
+void TaskPool::spawn(TaskGroup& group, TaskFunction run, void* arg) {
+    Task task;
+    task.run = run;
+    task.arg = arg;
+    task.group = &group;
+    group.pending.fetch_add(1, memory_order_relaxed);
+    call_once(workersStarted, &TaskPool::startWorkers, this);
+
+    TaskQueue& q = queues[currentQueue()];
+    {
+        lock_guard<mutex> guard(q.lock);
+        if (q.count < TASK_QUEUE_CAPACITY) {
+            q.items[(q.head + q.count) % TASK_QUEUE_CAPACITY] = task;
+            q.count++;
+            queuedTasks.fetch_add(1, memory_order_relaxed);
+            task.run = nullptr;
+        }
+    }
+
+    if (task.run != nullptr) {
+        execute(task);
+        return;
+    }
+    if (workerCount > 0) {
+        lock_guard<mutex> guard(sleepLock);
+        wakeUp.notify_one();
+    }
+}
+
+/*
+============================================================
+Function    : wait
+Description : Blocks until every task in the group is done.
+              The waiting thread keeps running queued tasks in
+              the meantime instead of sitting idle.
+Input       : group - Group to wait for (TaskGroup&)
+Return      : None
+============================================================
+*/
+void TaskPool::wait(TaskGroup& group) {
+    int queue = currentQueue();
+    while (group.pending.load(memory_order_acquire) > 0) {
+        if (!runOne(queue)) {
+            this_thread::yield();
+        }
+    }
+}
+
+/*
+============================================================
+Function    : hardwareThreadCount
+Description : Returns the number of hardware threads, or 1 if
+              the platform cannot tell.
+Input       : None
+Return      : Thread count (int)
+============================================================
+*/
+int hardwareThreadCount() {
+    unsigned int threads = thread::hardware_concurrency();
+    return (threads == 0) ? 1 : (int)threads;
+}
+
+/*
+============================================================
+Function    : sharedTaskPool
+Description : Returns the process-wide pool, created on first
+              use. Startup always passes it to the CSV loader
+              and hash build, but its threads only start when
+              one of them (or a large sort) actually spawns a
+              task, so a small catalog never starts any.
+Input       : None
+Return      : The shared pool (TaskPool&)
+============================================================
+*/
+TaskPool& sharedTaskPool() {
+    static TaskPool pool(hardwareThreadCount());
+    return pool;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+using namespace std;
+
+const int TASK_QUEUE_CAPACITY = 1024;   // tasks per queue (ring buffer)
+
+typedef void (*TaskFunction)(void* arg);
+
+/*
+============================================================
+Class       : TaskGroup
+Description : Counts the tasks spawned for one fork-join step.
+              TaskPool::wait returns once every task spawned
+              into the group has finished. Lives on the stack
+              of the function that forks.
+============================================================
+*/
+class TaskGroup {
+private:
+    atomic<int> pending;
+    friend class TaskPool;
+
+public:
+    TaskGroup();
+};
+
+/*
+============================================================
+Class       : TaskPool
+Description : Fixed set of worker threads with one task queue
+              each. A thread pushes and pops work at the back
+              of its own queue (newest first, good locality)
+              and, when that is empty, steals from the front
+              of another queue (oldest, i.e. biggest, pieces
+              of a divide-and-conquer job). Threads that are
+              not workers, such as main, share one extra queue
+              and help run tasks while they wait, so a pool of
+              N threads starts N - 1 workers. The workers are
+              only started by the first spawn(), so a pool that
+              is never given work costs no threads. If a queue
+              is full the task simply runs on the spot.
+============================================================
+*/
+class TaskPool {
+private:
+    struct Task {
+        TaskFunction run;
+        void* arg;
+        TaskGroup* group;
+    };
+
+    struct TaskQueue {
+        mutex lock;
+        Task items[TASK_QUEUE_CAPACITY];
+        int head;    // oldest task (steal end)
+        int count;
+    };
+
+    TaskQueue* queues;      // one per worker, plus one for outside threads
+    int queueCount;
+    thread* workers;
+    int workerCount;
+    once_flag workersStarted;   // workers start on the first spawn
+
+    atomic<int> queuedTasks;
+    atomic<bool> stopping;
+    mutex sleepLock;
+    condition_variable wakeUp;
+
+    int currentQueue() const;
+    bool popOwn(int queue, Task& task);
+    bool steal(int thief, Task& task);
+    bool runOne(int queue);
+    void execute(const Task& task);
+    void workerLoop(int queue);
+    void startWorkers();
+
+    // Not copyable: owns its threads
+    TaskPool(const TaskPool&);
+    TaskPool& operator=(const TaskPool&);
+
+public:
+    TaskPool(int threadCount);
+    ~TaskPool();
+
+    int threadCount() const;
+    void spawn(TaskGroup& group, TaskFunction run, void* arg);
+    void wait(TaskGroup& group);
+};
+
+// Process-wide pool sized to the machine; its threads start with its first task
+TaskPool& sharedTaskPool();
+int hardwareThreadCount();
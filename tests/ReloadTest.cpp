@@ -0,0 +1,122 @@
+#include "../Admin.h"
+#include "../GameManager.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+/*
+============================================================
+File        : ReloadTest.cpp
+Description : Checks that reloading games.csv keeps every
+              game's identity (ID, loan, borrow count) when
+              rows are inserted or deleted mid-file. Built on
+              its own, with every source file except
+              DSA_ASG.cpp, e.g.
+              g++ -std=c++17 -pthread tests/ReloadTest.cpp
+                  $(ls *.cpp | grep -v DSA_ASG)
+              Returns 0 if every check passes.
+============================================================
+*/
+
+static const char* TEST_CSV = "reload_test.csv";
+static const char* TEST_JOURNAL = "reload_test.journal";
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    cout << (condition ? "PASS: " : "FAIL: ") << what << "\n";
+    if (!condition) failures++;
+}
+
+static void writeCsv(const char* const rows[], int n) {
+    ofstream file(TEST_CSV);
+    file << "title,minPlayers,maxPlayers,maxPlaytime,minPlaytime,yearPublished\n";
+    for (int i = 0; i < n; i++) file << rows[i] << "\n";
+}
+
+static void noReplay(unsigned char, JournalReader&, void*) {}
+
+// Title of the game with this ID, or "" if there is none
+static string titleOf(const SegmentedArray<Game>& games, const HashTable& gameHash, const string& id) {
+    int idx = gameHash.search(id);
+    return idx == -1 ? string() : games[idx].getTitle();
+}
+
+int main() {
+    const char* const before[] = {
+        "\"Azul\",2,4,45,30,2017",
+        "\"Brass\",2,4,120,60,2018",
+        "\"Catan\",3,4,120,60,1995",
+    };
+    writeCsv(before, 3);
+
+    SegmentedArray<Game> games;
+    int gameCount = loadGamesFromCSV(TEST_CSV, games);
+    SlotMap gameSlots;
+    gameSlots.reset(gameCount);
+    HashTable gameHash;
+    buildHashTable(games, gameCount, gameHash);
+    GameCatalog catalog;
+    catalog.rebuild(games, gameCount);
+    Journal journal;
+    journal.open(TEST_JOURNAL, 0, 0, noReplay, nullptr);
+
+    // Brass (G002) is on loan; Dixit is added from the menu
+    int brass = gameHash.search("G002");
+    games[brass].setStatus("Borrowed");
+    games[brass].setBorrowedBy(memberIds.intern("M001"));
+    games[brass].setBorrowCount(3);
+    catalog.update(brass, games[brass]);
+    adminApplyAddGame(games, gameSlots, gameHash, catalog, Game("G100", "Dixit", 3, 6, 30, 30, 2008));
+
+    // A row inserted before Brass, Dixit now in the file, Catan's playtime edited
+    const char* const inserted[] = {
+        "\"Azul\",2,4,45,30,2017",
+        "\"Agricola\",1,4,150,30,2007",
+        "\"Brass\",2,4,120,60,2018",
+        "\"Catan\",3,4,90,60,1995",
+        "\"Dixit\",3,6,30,30,2008",
+    };
+    writeCsv(inserted, 5);
+    adminReloadGames(TEST_CSV, games, gameSlots, gameHash, catalog, journal);
+
+    check(titleOf(games, gameHash, "G001") == "Azul", "Azul keeps G001");
+    check(titleOf(games, gameHash, "G002") == "Brass", "Brass keeps G002 after a row is inserted before it");
+    brass = gameHash.search("G002");
+    check(brass != -1 && games[brass].getStatus() == "Borrowed" && games[brass].getBorrowedBy() == "M001",
+        "Brass is still on loan to M001");
+    check(brass != -1 && games[brass].getBorrowCount() == 3, "Brass keeps its borrow count");
+    int catan = gameHash.search("G003");
+    check(catan != -1 && games[catan].getTitle() == "Catan" && games[catan].getMaxPlaytime() == 90,
+        "Catan keeps G003 and takes the edited playtime");
+    check(catan != -1 && games[catan].getStatus() == "Available", "Catan did not take Brass's loan");
+    check(titleOf(games, gameHash, "G100") == "Dixit", "the menu-added Dixit keeps G100");
+    check(titleOf(games, gameHash, "G004") == "Agricola", "Agricola gets the first unused ID");
+    check(gameSlots.size() == 5, "five games after the insert");
+
+    // Azul deleted from the top of the file
+    const char* const deleted[] = {
+        "\"Agricola\",1,4,150,30,2007",
+        "\"Brass\",2,4,120,60,2018",
+        "\"Catan\",3,4,90,60,1995",
+        "\"Dixit\",3,6,30,30,2008",
+    };
+    writeCsv(deleted, 4);
+    adminReloadGames(TEST_CSV, games, gameSlots, gameHash, catalog, journal);
+
+    check(gameHash.search("G001") == -1, "Azul is removed");
+    brass = gameHash.search("G002");
+    check(brass != -1 && games[brass].getTitle() == "Brass" && games[brass].getStatus() == "Borrowed",
+        "Brass keeps G002 and its loan after a row above it is deleted");
+    check(titleOf(games, gameHash, "G004") == "Agricola", "Agricola keeps G004");
+    check(!adminReloadGames(TEST_CSV, games, gameSlots, gameHash, catalog, journal),
+        "reloading the same file changes nothing");
+
+    journal.close();
+    remove(TEST_CSV);
+    remove(TEST_JOURNAL);
+
+    cout << (failures == 0 ? "All reload checks passed.\n" : "Some reload checks FAILED.\n");
+    return failures == 0 ? 0 : 1;
+}